@@ -31,6 +31,15 @@ export type Spec = {|
     props: NodeProps,
     instanceHandle: InstanceHandle,
   ) => Node,
+  // `nodes` is a flat array of
+  // `[reactTag, viewName, props, instanceHandle, childIndices]` quintuples
+  // (children must precede their parents); returns nodes at `indices` (or
+  // nodes which are not children of other nodes of the batch).
+  +createNodes: (
+    rootTag: RootTag,
+    nodes: $ReadOnlyArray<mixed>,
+    indices?: $ReadOnlyArray<number>,
+  ) => Array<Node>,
   +cloneNode: (node: Node) => Node,
   +cloneNodeWithNewChildren: (node: Node) => Node,
   +cloneNodeWithNewProps: (node: Node, newProps: NodeProps) => Node,
@@ -38,8 +47,26 @@ export type Spec = {|
   +createChildSet: (rootTag: RootTag) => NodeSet,
   +appendChild: (parentNode: Node, child: Node) => Node,
   +appendChildToSet: (childSet: NodeSet, child: Node) => void,
-  +completeRoot: (rootTag: RootTag, childSet: NodeSet) => void,
+  +appendChildrenToSet: (
+    childSet: NodeSet,
+    children: $ReadOnlyArray<Node>,
+  ) => void,
+  // `childSet` is either created by `createChildSet` or an array of nodes.
+  +completeRoot: (
+    rootTag: RootTag,
+    childSet: NodeSet | $ReadOnlyArray<Node>,
+  ) => void,
   +measure: (node: Node, callback: MeasureOnSuccessCallback) => void,
+  // Measures all nodes against the same revision of the tree; the callback
+  // receives one `[x, y, width, height, pageX, pageY]` array per node.
+  +measureMany: (
+    nodes: $ReadOnlyArray<Node>,
+    callback: (
+      measurements: $ReadOnlyArray<
+        [number, number, number, number, number, number],
+      >,
+    ) => void,
+  ) => void,
   +measureInWindow: (
     node: Node,
     callback: MeasureInWindowOnSuccessCallback,
@@ -212,28 +212,28 @@ using namespace facebook::react;
   }
 
   // `shadowColor`
-  if (oldViewProps.shadowColor != newViewProps.shadowColor) {
-    CGColorRef shadowColor = RCTCreateCGColorRefFromSharedColor(newViewProps.shadowColor);
+  if (oldViewProps.shadowColor() != newViewProps.shadowColor()) {
+    CGColorRef shadowColor = RCTCreateCGColorRefFromSharedColor(newViewProps.shadowColor());
     self.layer.shadowColor = shadowColor;
     CGColorRelease(shadowColor);
     needsInvalidateLayer = YES;
   }
 
   // `shadowOffset`
-  if (oldViewProps.shadowOffset != newViewProps.shadowOffset) {
-    self.layer.shadowOffset = RCTCGSizeFromSize(newViewProps.shadowOffset);
+  if (oldViewProps.shadowOffset() != newViewProps.shadowOffset()) {
+    self.layer.shadowOffset = RCTCGSizeFromSize(newViewProps.shadowOffset());
     needsInvalidateLayer = YES;
   }
 
   // `shadowOpacity`
-  if (oldViewProps.shadowOpacity != newViewProps.shadowOpacity) {
-    self.layer.shadowOpacity = (float)newViewProps.shadowOpacity;
+  if (oldViewProps.shadowOpacity() != newViewProps.shadowOpacity()) {
+    self.layer.shadowOpacity = (float)newViewProps.shadowOpacity();
     needsInvalidateLayer = YES;
   }
 
   // `shadowRadius`
-  if (oldViewProps.shadowRadius != newViewProps.shadowRadius) {
-    self.layer.shadowRadius = (CGFloat)newViewProps.shadowRadius;
+  if (oldViewProps.shadowRadius() != newViewProps.shadowRadius()) {
+    self.layer.shadowRadius = (CGFloat)newViewProps.shadowRadius();
     needsInvalidateLayer = YES;
   }
 
@@ -261,12 +261,12 @@ using namespace facebook::react;
   }
 
   // `hitSlop`
-  if (oldViewProps.hitSlop != newViewProps.hitSlop) {
+  if (oldViewProps.hitSlop() != newViewProps.hitSlop()) {
     self.hitTestEdgeInsets = {
-        -newViewProps.hitSlop.top,
-        -newViewProps.hitSlop.left,
-        -newViewProps.hitSlop.bottom,
-        -newViewProps.hitSlop.right};
+        -newViewProps.hitSlop().top,
+        -newViewProps.hitSlop().left,
+        -newViewProps.hitSlop().bottom,
+        -newViewProps.hitSlop().right};
   }
 
   // `overflow`
@@ -276,8 +276,9 @@ using namespace facebook::react;
   }
 
   // `border`
-  if (oldViewProps.borderStyles != newViewProps.borderStyles || oldViewProps.borderRadii != newViewProps.borderRadii ||
-      oldViewProps.borderColors != newViewProps.borderColors) {
+  if (oldViewProps.borderStyles() != newViewProps.borderStyles() ||
+      oldViewProps.borderRadii() != newViewProps.borderRadii() ||
+      oldViewProps.borderColors() != newViewProps.borderColors()) {
     needsInvalidateLayer = YES;
   }
 
@@ -114,7 +114,9 @@ static void RCTPerformMountInstructions(
 
         RCTAssert(newChildShadowView.props, @"`newChildShadowView.props` must not be null.");
 
-        if (oldChildShadowView.props != newChildShadowView.props) {
+        // Props objects cloned from the mounted ones without any (known) props specified are equal to them.
+        auto propsChangeSet = mutation.getPropsChangeSet();
+        if (oldChildShadowView.props != newChildShadowView.props && (!propsChangeSet || propsChangeSet->size() > 0)) {
           [newChildComponentView updateProps:newChildShadowView.props oldProps:oldChildShadowView.props];
           mask |= RNComponentViewUpdateMaskProps;
         }
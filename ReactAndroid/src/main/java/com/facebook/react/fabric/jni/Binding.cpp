@@ -131,6 +131,10 @@ void Binding::startSurface(
 
   surfaceHandler.getMountingCoordinator()->setMountingOverrideDelegate(
       animationDriver_);
+  // `FabricMountingManager` mounts compact transactions without decoding
+  // them.
+  surfaceHandler.getMountingCoordinator()->setCompactMutationEncodingEnabled(
+      enableCompactMutationEncoding_);
 
   {
     SystraceSection s2("FabricUIManagerBinding::startSurface::surfaceId::lock");
@@ -200,6 +204,10 @@ void Binding::startSurfaceWithConstraints(
 
   surfaceHandler.getMountingCoordinator()->setMountingOverrideDelegate(
       animationDriver_);
+  // `FabricMountingManager` mounts compact transactions without decoding
+  // them.
+  surfaceHandler.getMountingCoordinator()->setCompactMutationEncodingEnabled(
+      enableCompactMutationEncoding_);
 
   {
     SystraceSection s2(
@@ -378,6 +386,9 @@ void Binding::installFabricUIManager(
   disablePreallocationOnClone_ = config->getBool(
       "react_native_new_architecture:disable_preallocation_on_clone_android");
 
+  enableCompactMutationEncoding_ = config->getBool(
+      "react_fabric:enable_compact_mutation_encoding_android");
+
   if (enableFabricLogs_) {
     LOG(WARNING) << "Binding::installFabricUIManager() was called (address: "
                  << this << ").";
@@ -157,6 +157,7 @@ class Binding : public jni::HybridClass<Binding>,
   bool disableRevisionCheckForPreallocation_{false};
   bool dispatchPreallocationInBackground_{false};
   bool disablePreallocationOnClone_{false};
+  bool enableCompactMutationEncoding_{false};
 };
 
 } // namespace react
@@ -14,6 +14,7 @@
 #include <react/renderer/components/scrollview/ScrollViewProps.h>
 #include <react/renderer/core/conversions.h>
 #include <react/renderer/debug/SystraceSection.h>
+#include <react/renderer/mounting/CompactShadowViewMutationList.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
 
 #include <fbjni/fbjni.h>
@@ -227,6 +228,48 @@ local_ref<JString> getPlatformComponentName(ShadowView const &shadowView) {
   return componentName;
 }
 
+namespace {
+
+/*
+ * References the parts of a mutation that are needed to build mount items.
+ * The `ShadowView`s stay where they are stored (a `ShadowViewMutation` or the
+ * table of a `CompactShadowViewMutationList`), so compact transactions are
+ * mounted without being decoded.
+ */
+struct MutationReference final {
+  explicit MutationReference(ShadowViewMutation const &mutation)
+      : type(mutation.type),
+        index(mutation.index),
+        parentShadowView(mutation.parentShadowView),
+        oldChildShadowView(mutation.oldChildShadowView),
+        newChildShadowView(mutation.newChildShadowView),
+        isVirtual(mutation.mutatedViewIsVirtual()) {}
+
+  MutationReference(CompactShadowViewMutationList const &list, size_t i)
+      : MutationReference(list, list.getCompactMutation(i), i) {}
+
+  ShadowViewMutation::Type type;
+  int index;
+  ShadowView const &parentShadowView;
+  ShadowView const &oldChildShadowView;
+  ShadowView const &newChildShadowView;
+  bool isVirtual;
+
+ private:
+  MutationReference(
+      CompactShadowViewMutationList const &list,
+      CompactShadowViewMutation const &mutation,
+      size_t i)
+      : type(mutation.type),
+        index(mutation.index),
+        parentShadowView(list.getShadowView(mutation.parentShadowView)),
+        oldChildShadowView(list.getShadowView(mutation.oldChildShadowView)),
+        newChildShadowView(list.getShadowView(mutation.newChildShadowView)),
+        isVirtual(list.mutatedViewIsVirtual(i)) {}
+};
+
+} // namespace
+
 static inline float scale(Float value, Float pointScaleFactor) {
   std::feclearexcept(FE_ALL_EXCEPT);
   float result = value * pointScaleFactor;
@@ -280,7 +323,19 @@ void FabricMountingManager::executeMount(
 
   auto telemetry = mountingTransaction->getTelemetry();
   auto surfaceId = mountingTransaction->getSurfaceId();
-  auto &mutations = mountingTransaction->getMutations();
+  // Compact transactions are mounted straight from the compact encoding.
+  auto compactMutations = mountingTransaction->hasCompactMutations()
+      ? &mountingTransaction->getCompactMutations()
+      : nullptr;
+  auto mutations = compactMutations == nullptr
+      ? &mountingTransaction->getMutations()
+      : nullptr;
+  auto numberOfMutations = mountingTransaction->getNumberOfMutations();
+  auto getMutation = [&](size_t i) {
+    return compactMutations != nullptr
+        ? MutationReference{*compactMutations, i}
+        : MutationReference{(*mutations)[i]};
+  };
 
   auto revisionNumber = telemetry.getRevisionNumber();
 
@@ -308,14 +363,15 @@ void FabricMountingManager::executeMount(
     bool noRevisionCheck =
         disablePreallocateViews_ || disableRevisionCheckForPreallocation_;
 
-    for (const auto &mutation : mutations) {
+    for (size_t i = 0; i < numberOfMutations; i++) {
+      auto mutation = getMutation(i);
       const auto &parentShadowView = mutation.parentShadowView;
       const auto &oldChildShadowView = mutation.oldChildShadowView;
       const auto &newChildShadowView = mutation.newChildShadowView;
       auto &mutationType = mutation.type;
       auto &index = mutation.index;
 
-      bool isVirtual = mutation.mutatedViewIsVirtual();
+      bool isVirtual = mutation.isVirtual;
 
       switch (mutationType) {
         case ShadowViewMutation::Create: {
@@ -458,7 +514,8 @@ void FabricMountingManager::executeMount(
     if (shouldRememberAllocatedViews_ &&
         allocatedViewsIterator != allocatedViewRegistry_.end()) {
       auto &views = allocatedViewsIterator->second;
-      for (auto const &mutation : mutations) {
+      for (size_t i = 0; i < numberOfMutations; i++) {
+        auto mutation = getMutation(i);
         switch (mutation.type) {
           case ShadowViewMutation::Create:
             views.insert(mutation.newChildShadowView.tag);
@@ -338,20 +338,20 @@ static inline MapBuffer viewPropsDiff(
     builder.putInt(VP_BG_COLOR, toAndroidRepr(newProps.backgroundColor));
   }
 
-  if (oldProps.borderColors != newProps.borderColors) {
+  if (oldProps.borderColors() != newProps.borderColors()) {
     builder.putMapBuffer(
-        VP_BORDER_COLOR, convertBorderColors(newProps.borderColors));
+        VP_BORDER_COLOR, convertBorderColors(newProps.borderColors()));
   }
 
-  if (oldProps.borderRadii != newProps.borderRadii) {
+  if (oldProps.borderRadii() != newProps.borderRadii()) {
     builder.putMapBuffer(
-        VP_BORDER_RADII, convertBorderRadii(newProps.borderRadii));
+        VP_BORDER_RADII, convertBorderRadii(newProps.borderRadii()));
   }
 
-  if (oldProps.borderStyles != newProps.borderStyles) {
+  if (oldProps.borderStyles() != newProps.borderStyles()) {
     int value = -1;
-    if (newProps.borderStyles.all.has_value()) {
-      switch (newProps.borderStyles.all.value()) {
+    if (newProps.borderStyles().all.has_value()) {
+      switch (newProps.borderStyles().all.value()) {
         case BorderStyle::Solid:
           value = 0;
           break;
@@ -380,8 +380,8 @@ static inline MapBuffer viewPropsDiff(
   }
 #endif
 
-  if (oldProps.hitSlop != newProps.hitSlop) {
-    builder.putMapBuffer(VP_HIT_SLOP, convertEdgeInsets(newProps.hitSlop));
+  if (oldProps.hitSlop() != newProps.hitSlop()) {
+    builder.putMapBuffer(VP_HIT_SLOP, convertEdgeInsets(newProps.hitSlop()));
   }
 
   if (oldProps.importantForAccessibility !=
@@ -405,16 +405,16 @@ static inline MapBuffer viewPropsDiff(
   }
 
 #ifdef ANDROID
-  if (oldProps.nativeBackground != newProps.nativeBackground) {
+  if (oldProps.nativeBackground() != newProps.nativeBackground()) {
     builder.putMapBuffer(
         VP_NATIVE_BACKGROUND,
-        convertNativeBackground(newProps.nativeBackground));
+        convertNativeBackground(newProps.nativeBackground()));
   }
 
-  if (oldProps.nativeForeground != newProps.nativeForeground) {
+  if (oldProps.nativeForeground() != newProps.nativeForeground()) {
     builder.putMapBuffer(
         VP_NATIVE_FOREGROUND,
-        convertNativeBackground(newProps.nativeForeground));
+        convertNativeBackground(newProps.nativeForeground()));
   }
 #endif
 
@@ -476,8 +476,8 @@ static inline MapBuffer viewPropsDiff(
   }
 #endif
 
-  if (oldProps.shadowColor != newProps.shadowColor) {
-    builder.putInt(VP_SHADOW_COLOR, toAndroidRepr(newProps.shadowColor));
+  if (oldProps.shadowColor() != newProps.shadowColor()) {
+    builder.putInt(VP_SHADOW_COLOR, toAndroidRepr(newProps.shadowColor()));
   }
 
   if (oldProps.testId != newProps.testId) {
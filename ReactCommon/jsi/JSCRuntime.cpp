@@ -192,6 +192,8 @@ class JSCRuntime : public jsi::Runtime {
   jsi::Value lockWeakObject(jsi::WeakObject &) override;
 
   jsi::Array createArray(size_t length) override;
+  jsi::ArrayBuffer createArrayBuffer(
+      std::shared_ptr<jsi::MutableBuffer> buffer) override;
   size_t size(const jsi::Array &) override;
   size_t size(const jsi::ArrayBuffer &) override;
   uint8_t *data(const jsi::ArrayBuffer &) override;
@@ -1028,6 +1030,31 @@ jsi::Array JSCRuntime::createArray(size_t length) {
   return createObject(obj).getArray(*this);
 }
 
+jsi::ArrayBuffer JSCRuntime::createArrayBuffer(
+    std::shared_ptr<jsi::MutableBuffer> buffer) {
+#if defined(_JSC_NO_ARRAY_BUFFERS)
+  throw std::runtime_error("Unsupported");
+#else
+  auto data = buffer->data();
+  auto size = buffer->size();
+  // JSC calls the deallocator (which releases the buffer) when the
+  // ArrayBuffer is collected, and also if creating it fails.
+  auto context = new std::shared_ptr<jsi::MutableBuffer>(std::move(buffer));
+  JSValueRef exc = nullptr;
+  JSObjectRef obj = JSObjectMakeArrayBufferWithBytesNoCopy(
+      ctx_,
+      data,
+      size,
+      [](void *, void *context) {
+        delete static_cast<std::shared_ptr<jsi::MutableBuffer> *>(context);
+      },
+      context,
+      &exc);
+  checkException(obj, exc);
+  return createObject(obj).getArrayBuffer(*this);
+#endif
+}
+
 size_t JSCRuntime::size(const jsi::Array &arr) {
   return static_cast<size_t>(
       getProperty(arr, createPropNameID(getLengthString())).getNumber());
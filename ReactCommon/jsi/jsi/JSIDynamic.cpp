@@ -9,9 +9,13 @@
 
 #include <glog/logging.h>
 
+#include <folly/Optional.h>
 #include <folly/dynamic.h>
 #include <jsi/jsi.h>
 
+#include <string>
+#include <unordered_map>
+
 using namespace facebook::jsi;
 
 namespace facebook {
@@ -60,10 +64,37 @@ Value valueFromDynamicShallow(
   CHECK(false);
 }
 
+// Payloads usually contain many objects of the same shape (e.g. arrays of
+// touches or list items), so property names are created once per conversion.
+// The number of cached names is bounded to keep dictionaries with unique keys
+// from growing the cache.
+class PropNameIDCache {
+ public:
+  const PropNameID& get(Runtime& runtime, const std::string& name) {
+    auto it = cache_.find(name);
+    if (it != cache_.end()) {
+      return it->second;
+    }
+    if (cache_.size() < kMaxSize) {
+      return cache_.emplace(name, PropNameID::forUtf8(runtime, name))
+          .first->second;
+    }
+    uncached_ = PropNameID::forUtf8(runtime, name);
+    return *uncached_;
+  }
+
+ private:
+  static constexpr size_t kMaxSize = 256;
+
+  std::unordered_map<std::string, PropNameID> cache_;
+  folly::Optional<PropNameID> uncached_;
+};
+
 } // namespace
 
 Value valueFromDynamic(Runtime& runtime, const folly::dynamic& dynInput) {
   std::vector<FromDynamic> stack;
+  PropNameIDCache propNameIDs;
 
   Value ret = valueFromDynamicShallow(runtime, stack, dynInput);
 
@@ -74,7 +105,8 @@ Value valueFromDynamic(Runtime& runtime, const folly::dynamic& dynInput) {
     switch (top.dyn->type()) {
       case folly::dynamic::ARRAY: {
         Array arr = std::move(top.obj).getArray(runtime);
-        for (size_t i = 0; i < top.dyn->size(); ++i) {
+        size_t arraySize = top.dyn->size();
+        for (size_t i = 0; i < arraySize; ++i) {
           arr.setValueAtIndex(
               runtime,
               i,
@@ -85,7 +117,12 @@ Value valueFromDynamic(Runtime& runtime, const folly::dynamic& dynInput) {
       case folly::dynamic::OBJECT: {
         Object obj = std::move(top.obj);
         for (const auto& element : top.dyn->items()) {
-          if (element.first.isNumber() || element.first.isString()) {
+          if (element.first.isString()) {
+            obj.setProperty(
+                runtime,
+                propNameIDs.get(runtime, element.first.getString()),
+                valueFromDynamicShallow(runtime, stack, element.second));
+          } else if (element.first.isNumber()) {
             obj.setProperty(
                 runtime,
                 PropNameID::forUtf8(runtime, element.first.asString()),
@@ -105,11 +142,12 @@ Value valueFromDynamic(Runtime& runtime, const folly::dynamic& dynInput) {
 namespace {
 
 struct FromValue {
-  FromValue(folly::dynamic* dynArg, Object objArg)
-      : dyn(dynArg), obj(std::move(objArg)) {}
+  FromValue(folly::dynamic* dynArg, Object objArg, bool isArrayArg)
+      : dyn(dynArg), obj(std::move(objArg)), isArray(isArrayArg) {}
 
   folly::dynamic* dyn;
   Object obj;
+  bool isArray;
 };
 
 // This converts one element.  If it's a collection, it gets pushed
@@ -119,8 +157,9 @@ struct FromValue {
 void dynamicFromValueShallow(
     Runtime& runtime,
     std::vector<FromValue>& stack,
-    const jsi::Value& value,
-    folly::dynamic& output) {
+    jsi::Value value,
+    folly::dynamic& output,
+    bool isProperty) {
   if (value.isUndefined() || value.isNull()) {
     output = nullptr;
   } else if (value.isBool()) {
@@ -128,18 +167,25 @@ void dynamicFromValueShallow(
   } else if (value.isNumber()) {
     output = value.getNumber();
   } else if (value.isString()) {
-    output = value.getString(runtime).utf8(runtime);
+    output = std::move(value).getString(runtime).utf8(runtime);
   } else {
     CHECK(value.isObject());
-    Object obj = value.getObject(runtime);
+    Object obj = std::move(value).getObject(runtime);
     if (obj.isArray(runtime)) {
       output = folly::dynamic::array();
+      stack.emplace_back(&output, std::move(obj), true);
     } else if (obj.isFunction(runtime)) {
-      throw JSError(runtime, "JS Functions are not convertible to dynamic");
+      if (!isProperty) {
+        throw JSError(runtime, "JS Functions are not convertible to dynamic");
+      }
+      // The JSC conversion uses JSON.stringify, which substitutes
+      // null for a function, so we do the same here.  Just dropping
+      // the pair might also work, but would require more testing.
+      output = nullptr;
     } else {
       output = folly::dynamic::object();
+      stack.emplace_back(&output, std::move(obj), false);
     }
-    stack.emplace_back(&output, std::move(obj));
   }
 }
 
@@ -149,46 +195,46 @@ folly::dynamic dynamicFromValue(Runtime& runtime, const Value& valueInput) {
   std::vector<FromValue> stack;
   folly::dynamic ret;
 
-  dynamicFromValueShallow(runtime, stack, valueInput, ret);
+  dynamicFromValueShallow(
+      runtime, stack, Value(runtime, valueInput), ret, false);
 
   while (!stack.empty()) {
     auto top = std::move(stack.back());
     stack.pop_back();
 
-    if (top.obj.isArray(runtime)) {
+    if (top.isArray) {
       // Inserting into a dyn can invalidate references into it, so we
       // need to insert new elements up front, then push stuff onto
       // the stack.
-      Array array = top.obj.getArray(runtime);
+      Array array = std::move(top.obj).getArray(runtime);
       size_t arraySize = array.size(runtime);
-      for (size_t i = 0; i < arraySize; ++i) {
-        top.dyn->push_back(nullptr);
-      }
+      top.dyn->resize(arraySize);
       for (size_t i = 0; i < arraySize; ++i) {
         dynamicFromValueShallow(
-            runtime, stack, array.getValueAtIndex(runtime, i), top.dyn->at(i));
+            runtime,
+            stack,
+            array.getValueAtIndex(runtime, i),
+            (*top.dyn)[i],
+            false);
       }
     } else {
+      // Objects are node-based maps, so references to their values stay
+      // valid while other properties are inserted.
       Array names = top.obj.getPropertyNames(runtime);
-      std::vector<std::pair<std::string, jsi::Value>> props;
-      for (size_t i = 0; i < names.size(runtime); ++i) {
+      size_t namesSize = names.size(runtime);
+      top.dyn->reserve(namesSize);
+      for (size_t i = 0; i < namesSize; ++i) {
         String name = names.getValueAtIndex(runtime, i).getString(runtime);
         Value prop = top.obj.getProperty(runtime, name);
         if (prop.isUndefined()) {
           continue;
         }
-        // The JSC conversion uses JSON.stringify, which substitutes
-        // null for a function, so we do the same here.  Just dropping
-        // the pair might also work, but would require more testing.
-        if (prop.isObject() && prop.getObject(runtime).isFunction(runtime)) {
-          prop = Value::null();
-        }
-        props.emplace_back(name.utf8(runtime), std::move(prop));
-        top.dyn->insert(props.back().first, nullptr);
-      }
-      for (const auto& prop : props) {
         dynamicFromValueShallow(
-            runtime, stack, prop.second, (*top.dyn)[prop.first]);
+            runtime,
+            stack,
+            std::move(prop),
+            (*top.dyn)[name.utf8(runtime)],
+            true);
       }
     }
   }
@@ -72,6 +72,8 @@ void throwJSError(Runtime& rt, const char* msg) {
 
 Buffer::~Buffer() = default;
 
+MutableBuffer::~MutableBuffer() = default;
+
 PreparedJavaScript::~PreparedJavaScript() = default;
 
 Value HostObject::get(Runtime&, const PropNameID&) {
@@ -145,6 +147,12 @@ Value Runtime::createValueFromJsonUtf8(const uint8_t* json, size_t length) {
   return parseJson.call(*this, String::createFromUtf8(*this, json, length));
 }
 
+ArrayBuffer Runtime::createArrayBuffer(
+    std::shared_ptr<MutableBuffer> /*buffer*/) {
+  throw JSINativeException(
+      "createArrayBuffer is not implemented by " + description());
+}
+
 Pointer& Pointer::operator=(Pointer&& other) {
   if (ptr_) {
     ptr_->invalidate();
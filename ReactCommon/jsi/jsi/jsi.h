@@ -52,6 +52,18 @@ class JSI_EXPORT StringBuffer : public Buffer {
   std::string s_;
 };
 
+/// Base class for buffers of native memory which can be wrapped by an
+/// ArrayBuffer without copying (see Runtime::createArrayBuffer). The memory
+/// is shared: both JavaScript and native code may read and write it. The
+/// runtime retains the buffer for as long as the ArrayBuffer is alive, so
+/// data() must remain valid (and size() constant) for the buffer's lifetime.
+class JSI_EXPORT MutableBuffer {
+ public:
+  virtual ~MutableBuffer();
+  virtual size_t size() const = 0;
+  virtual uint8_t* data() = 0;
+};
+
 /// PreparedJavaScript is a base class representing JavaScript which is in a
 /// form optimized for execution, in a runtime-specific way. Construct one via
 /// jsi::Runtime::prepareJavaScript().
@@ -313,6 +325,11 @@ class JSI_EXPORT Runtime {
   virtual Value lockWeakObject(WeakObject&) = 0;
 
   virtual Array createArray(size_t length) = 0;
+  // \return an ArrayBuffer backed by the memory of \c buffer (without
+  // copying), which retains \c buffer until it is garbage collected. The
+  // default implementation throws a \c JSINativeException.
+  virtual ArrayBuffer createArrayBuffer(
+      std::shared_ptr<MutableBuffer> buffer);
   virtual size_t size(const Array&) = 0;
   virtual size_t size(const ArrayBuffer&) = 0;
   virtual uint8_t* data(const ArrayBuffer&) = 0;
@@ -810,6 +827,11 @@ class JSI_EXPORT Array : public Object {
 /// Represents a JSArrayBuffer
 class JSI_EXPORT ArrayBuffer : public Object {
  public:
+  /// Creates an ArrayBuffer backed by the memory of \c buffer without
+  /// copying it. The ArrayBuffer retains \c buffer.
+  ArrayBuffer(Runtime& runtime, std::shared_ptr<MutableBuffer> buffer)
+      : ArrayBuffer(runtime.createArrayBuffer(std::move(buffer))) {}
+
   ArrayBuffer(ArrayBuffer&&) = default;
   ArrayBuffer& operator=(ArrayBuffer&&) = default;
 
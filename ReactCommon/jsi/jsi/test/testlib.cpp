@@ -14,6 +14,7 @@
 #include <stdlib.h>
 #include <chrono>
 #include <functional>
+#include <optional>
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
@@ -1425,6 +1426,54 @@ TEST_P(JSITest, MultilevelDecoratedHostObject) {
   EXPECT_EQ(1, RD2::numGets);
 }
 
+TEST_P(JSITest, ArrayBufferFromMutableBufferTest) {
+  class VectorBuffer : public MutableBuffer {
+   public:
+    explicit VectorBuffer(size_t size) : vector_(size) {}
+    size_t size() const override {
+      return vector_.size();
+    }
+    uint8_t* data() override {
+      return vector_.data();
+    }
+
+   private:
+    std::vector<uint8_t> vector_;
+  };
+
+  auto buffer = std::make_shared<VectorBuffer>(8);
+  std::weak_ptr<VectorBuffer> weakBuffer = buffer;
+  buffer->data()[0] = 42;
+
+  std::optional<ArrayBuffer> optionalArrayBuffer;
+  try {
+    optionalArrayBuffer.emplace(rt, buffer);
+  } catch (const JSINativeException&) {
+    GTEST_SKIP() << "The runtime does not support creating ArrayBuffers.";
+  }
+  auto& arrayBuffer = *optionalArrayBuffer;
+
+  // The memory is shared, not copied.
+  EXPECT_EQ(arrayBuffer.size(rt), 8);
+  EXPECT_EQ(arrayBuffer.data(rt), buffer->data());
+  EXPECT_TRUE(Value(rt, arrayBuffer).getObject(rt).isArrayBuffer(rt));
+  EXPECT_EQ(
+      function("function(buffer) {"
+               "  var bytes = new Uint8Array(buffer);"
+               "  bytes[1] = bytes[0] + 1;"
+               "  return bytes.length;"
+               "}")
+          .call(rt, arrayBuffer)
+          .getNumber(),
+      8);
+  EXPECT_EQ(buffer->data()[1], 43);
+
+  // The ArrayBuffer retains the buffer.
+  buffer.reset();
+  EXPECT_FALSE(weakBuffer.expired());
+  EXPECT_EQ(arrayBuffer.data(rt)[1], 43);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     Runtimes,
     JSITest,
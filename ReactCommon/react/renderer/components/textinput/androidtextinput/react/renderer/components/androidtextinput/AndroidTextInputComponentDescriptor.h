@@ -160,9 +160,10 @@ class AndroidTextInputComponentDescriptor final
       // commit, state update, etc, will incur this cost.
       if (changedPadding) {
         // Set new props on node
-        const_cast<AndroidTextInputProps &>(
-            textInputShadowNode->getConcreteProps())
-            .yogaStyle.padding() = result;
+        auto &props = const_cast<AndroidTextInputProps &>(
+            textInputShadowNode->getConcreteProps());
+        props.yogaStyle.padding() = result;
+        props.changeSet.invalidate();
         // Communicate new props to Yoga part of the node
         textInputShadowNode->updateYogaProps();
       }
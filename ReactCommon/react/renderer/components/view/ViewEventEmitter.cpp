@@ -39,6 +39,21 @@ void ViewEventEmitter::onLayout(const LayoutMetrics &layoutMetrics) const {
   // ownership that will be captured by lambda.
   auto layoutEventState = layoutEventState_;
 
+  if (!scheduleLayoutEvent(*layoutEventState, layoutMetrics.frame)) {
+    return;
+  }
+
+  dispatchEvent(
+      "layout",
+      [layoutEventState](jsi::Runtime &runtime) {
+        return layoutEventPayload(runtime, *layoutEventState);
+      },
+      EventPriority::AsynchronousUnbatched);
+}
+
+bool ViewEventEmitter::scheduleLayoutEvent(
+    LayoutEventState &layoutEventState,
+    Rect const &frame) {
   // Dispatched `frame` values to JavaScript thread are throttled here.
   // Basic ideas:
   //  - Scheduling a lambda with some value that already was dispatched, does
@@ -54,65 +69,106 @@ void ViewEventEmitter::onLayout(const LayoutMetrics &layoutMetrics) const {
   //    can be skipped (only the very last will be delivered).
   //  - Ordering is preserved.
 
+  std::lock_guard<std::mutex> guard(layoutEventState.mutex);
+
+  // If a *particular* `frame` was already dispatched to the JavaScript side,
+  // no other work is required.
+  if (layoutEventState.frame == frame && layoutEventState.wasDispatched) {
+    return false;
+  }
+
+  // If the *particular* `frame` was not already dispatched *or*
+  // some *other* `frame` was dispatched before,
+  // we need to schedule the dispatching.
+  layoutEventState.wasDispatched = false;
+  layoutEventState.frame = frame;
+
+  // Something is already in flight, dispatching another event is not
+  // required.
+  if (layoutEventState.isDispatching) {
+    return false;
+  }
+
+  layoutEventState.isDispatching = true;
+  return true;
+}
+
+jsi::Value ViewEventEmitter::layoutEventPayload(
+    jsi::Runtime &runtime,
+    LayoutEventState &layoutEventState) {
+  auto frame = Rect{};
+
   {
-    std::lock_guard<std::mutex> guard(layoutEventState->mutex);
+    std::lock_guard<std::mutex> guard(layoutEventState.mutex);
 
-    // If a *particular* `frame` was already dispatched to the JavaScript side,
-    // no other work is required.
-    if (layoutEventState->frame == layoutMetrics.frame &&
-        layoutEventState->wasDispatched) {
-      return;
+    layoutEventState.isDispatching = false;
+
+    // If some *particular* `frame` was already dispatched before,
+    // and since then there were no other new values of the `frame`
+    // observed, do nothing.
+    if (layoutEventState.wasDispatched) {
+      return jsi::Value::null();
     }
 
-    // If the *particular* `frame` was not already dispatched *or*
-    // some *other* `frame` was dispatched before,
-    // we need to schedule the dispatching.
-    layoutEventState->wasDispatched = false;
-    layoutEventState->frame = layoutMetrics.frame;
+    frame = layoutEventState.frame;
 
-    // Something is already in flight, dispatching another event is not
-    // required.
-    if (layoutEventState->isDispatching) {
-      return;
-    }
+    // If some *particular* `frame` was *not* already dispatched before,
+    // it's time to dispatch it and mark as dispatched.
+    layoutEventState.wasDispatched = true;
+  }
+
+  auto layout = jsi::Object(runtime);
+  layout.setProperty(runtime, "x", frame.origin.x);
+  layout.setProperty(runtime, "y", frame.origin.y);
+  layout.setProperty(runtime, "width", frame.size.width);
+  layout.setProperty(runtime, "height", frame.size.height);
+  auto payload = jsi::Object(runtime);
+  payload.setProperty(runtime, "layout", std::move(layout));
+  return jsi::Value(std::move(payload));
+}
 
-    layoutEventState->isDispatching = true;
+#pragma mark - Layout Event Batch
+
+void ViewEventEmitter::LayoutEventBatch::reserve(size_t size) {
+  eventTargets_.reserve(size);
+  layoutEventStates_.reserve(size);
+}
+
+void ViewEventEmitter::LayoutEventBatch::add(
+    ViewEventEmitter const &eventEmitter,
+    LayoutMetrics const &layoutMetrics) {
+  // An emitter that is already in the batch has `isDispatching` set, so only
+  // its frame gets updated here; the batch delivers the most recent one.
+  if (!scheduleLayoutEvent(
+          *eventEmitter.layoutEventState_, layoutMetrics.frame)) {
+    return;
   }
 
-  dispatchEvent(
+  if (eventEmitter_ == nullptr) {
+    eventEmitter_ = &eventEmitter;
+  }
+
+  eventTargets_.push_back(eventEmitter.getEventTarget());
+  layoutEventStates_.push_back(eventEmitter.layoutEventState_);
+}
+
+void ViewEventEmitter::LayoutEventBatch::dispatch() {
+  if (eventEmitter_ == nullptr) {
+    return;
+  }
+
+  eventEmitter_->dispatchEventBatch(
       "layout",
-      [layoutEventState](jsi::Runtime &runtime) {
-        auto frame = Rect{};
-
-        {
-          std::lock_guard<std::mutex> guard(layoutEventState->mutex);
-
-          layoutEventState->isDispatching = false;
-
-          // If some *particular* `frame` was already dispatched before,
-          // and since then there were no other new values of the `frame`
-          // observed, do nothing.
-          if (layoutEventState->wasDispatched) {
-            return jsi::Value::null();
-          }
-
-          frame = layoutEventState->frame;
-
-          // If some *particular* `frame` was *not* already dispatched before,
-          // it's time to dispatch it and mark as dispatched.
-          layoutEventState->wasDispatched = true;
-        }
-
-        auto layout = jsi::Object(runtime);
-        layout.setProperty(runtime, "x", frame.origin.x);
-        layout.setProperty(runtime, "y", frame.origin.y);
-        layout.setProperty(runtime, "width", frame.size.width);
-        layout.setProperty(runtime, "height", frame.size.height);
-        auto payload = jsi::Object(runtime);
-        payload.setProperty(runtime, "layout", std::move(layout));
-        return jsi::Value(std::move(payload));
+      std::move(eventTargets_),
+      [layoutEventStates = std::move(layoutEventStates_)](
+          jsi::Runtime &runtime, size_t index) {
+        return layoutEventPayload(runtime, *layoutEventStates[index]);
       },
       EventPriority::AsynchronousUnbatched);
+
+  eventEmitter_ = nullptr;
+  eventTargets_ = {};
+  layoutEventStates_ = {};
 }
 
 } // namespace react
@@ -9,6 +9,7 @@
 
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include <react/renderer/core/LayoutMetrics.h>
 #include <react/renderer/core/ReactPrimitives.h>
@@ -37,6 +38,42 @@ class ViewEventEmitter : public TouchEventEmitter {
 
   void onLayout(const LayoutMetrics &layoutMetrics) const;
 
+ private:
+  struct LayoutEventState;
+
+ public:
+  /*
+   * Collects `layout` events of many emitters (e.g. of all nodes affected by
+   * a commit) and dispatches them as a single batched event (see
+   * `RawEvent::batchedEventTargets`) instead of one event per emitter.
+   * Events are throttled exactly like the ones sent by `onLayout`; in
+   * particular, an emitter added several times (or having an event in flight)
+   * delivers only its most recent frame.
+   * Not thread-safe; all added emitters must outlive the call of `dispatch`.
+   */
+  class LayoutEventBatch final {
+   public:
+    void reserve(size_t size);
+
+    /*
+     * Adds a `layout` event of the given emitter to the batch.
+     * The equivalent of calling `onLayout` on the emitter.
+     */
+    void add(
+        ViewEventEmitter const &eventEmitter,
+        LayoutMetrics const &layoutMetrics);
+
+    /*
+     * Dispatches all collected events and clears the batch.
+     */
+    void dispatch();
+
+   private:
+    ViewEventEmitter const *eventEmitter_{nullptr};
+    std::vector<SharedEventTarget> eventTargets_{};
+    std::vector<std::shared_ptr<LayoutEventState>> layoutEventStates_{};
+  };
+
  private:
   /*
    * Contains the most recent `frame` and a `mutex` protecting access to it.
@@ -65,6 +102,22 @@ class ViewEventEmitter : public TouchEventEmitter {
     bool isDispatching{false};
   };
 
+  /*
+   * Records the given `frame` in the state; returns `true` if an event has
+   * to be dispatched to deliver it (see the throttling rules in `onLayout`).
+   */
+  static bool scheduleLayoutEvent(
+      LayoutEventState &layoutEventState,
+      Rect const &frame);
+
+  /*
+   * Builds the payload of a scheduled `layout` event out of the most recent
+   * `frame`; returns `null` if that `frame` was already delivered.
+   */
+  static jsi::Value layoutEventPayload(
+      jsi::Runtime &runtime,
+      LayoutEventState &layoutEventState);
+
   mutable std::shared_ptr<LayoutEventState> layoutEventState_{
       std::make_shared<LayoutEventState>()};
 };
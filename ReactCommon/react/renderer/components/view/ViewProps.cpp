@@ -8,6 +8,8 @@
 #include "ViewProps.h"
 
 #include <algorithm>
+#include <tuple>
+#include <utility>
 
 #include <react/renderer/components/view/conversions.h>
 #include <react/renderer/components/view/propsConversions.h>
@@ -43,51 +45,6 @@ ViewProps::ViewProps(
           "backgroundColor",
           sourceProps.backgroundColor,
           {})),
-      borderRadii(convertRawProp(
-          context,
-          rawProps,
-          "border",
-          "Radius",
-          sourceProps.borderRadii,
-          {})),
-      borderColors(convertRawProp(
-          context,
-          rawProps,
-          "border",
-          "Color",
-          sourceProps.borderColors,
-          {})),
-      borderStyles(convertRawProp(
-          context,
-          rawProps,
-          "border",
-          "Style",
-          sourceProps.borderStyles,
-          {})),
-      shadowColor(convertRawProp(
-          context,
-          rawProps,
-          "shadowColor",
-          sourceProps.shadowColor,
-          {})),
-      shadowOffset(convertRawProp(
-          context,
-          rawProps,
-          "shadowOffset",
-          sourceProps.shadowOffset,
-          {})),
-      shadowOpacity(convertRawProp(
-          context,
-          rawProps,
-          "shadowOpacity",
-          sourceProps.shadowOpacity,
-          {})),
-      shadowRadius(convertRawProp(
-          context,
-          rawProps,
-          "shadowRadius",
-          sourceProps.shadowRadius,
-          {})),
       transform(convertRawProp(
           context,
           rawProps,
@@ -114,12 +71,6 @@ ViewProps::ViewProps(
           "pointerEvents",
           sourceProps.pointerEvents,
           {})),
-      hitSlop(convertRawProp(
-          context,
-          rawProps,
-          "hitSlop",
-          sourceProps.hitSlop,
-          {})),
       onLayout(convertRawProp(
           context,
           rawProps,
@@ -147,18 +98,6 @@ ViewProps::ViewProps(
           "elevation",
           sourceProps.elevation,
           {})),
-      nativeBackground(convertRawProp(
-          context,
-          rawProps,
-          "nativeBackgroundAndroid",
-          sourceProps.nativeBackground,
-          {})),
-      nativeForeground(convertRawProp(
-          context,
-          rawProps,
-          "nativeForegroundAndroid",
-          sourceProps.nativeForeground,
-          {})),
       focusable(convertRawProp(
           context,
           rawProps,
@@ -184,7 +123,148 @@ ViewProps::ViewProps(
           sourceProps.renderToHardwareTextureAndroid,
           {}))
 #endif
-          {};
+      ,
+      coldProps_(sourceProps.coldProps_) {
+  setColdPropsFromRawProps(context, rawProps);
+}
+
+#pragma mark - Cold Props
+
+bool ViewColdProps::operator==(ViewColdProps const &rhs) const {
+  return std::tie(
+             this->borderRadii,
+             this->borderColors,
+             this->borderStyles,
+             this->shadowColor,
+             this->shadowOffset,
+             this->shadowOpacity,
+             this->shadowRadius,
+             this->hitSlop
+#ifdef ANDROID
+             ,
+             this->nativeBackground,
+             this->nativeForeground
+#endif
+             ) ==
+      std::tie(
+             rhs.borderRadii,
+             rhs.borderColors,
+             rhs.borderStyles,
+             rhs.shadowColor,
+             rhs.shadowOffset,
+             rhs.shadowOpacity,
+             rhs.shadowRadius,
+             rhs.hitSlop
+#ifdef ANDROID
+             ,
+             rhs.nativeBackground,
+             rhs.nativeForeground
+#endif
+      );
+}
+
+bool ViewColdProps::operator!=(ViewColdProps const &rhs) const {
+  return !(*this == rhs);
+}
+
+std::shared_ptr<ViewColdProps const> const &ViewProps::defaultColdProps() {
+  static auto const coldProps = std::make_shared<ViewColdProps const>();
+  return coldProps;
+}
+
+/*
+ * Writes `value` to the cold props of `props` unless it is there already.
+ * Cold props shared with other props objects are copied on the first write.
+ */
+template <typename T>
+static void
+setColdProp(ViewProps &props, T ViewColdProps::*member, T const &value) {
+  if (!(props.coldProps().*member == value)) {
+    props.mutableColdProps().*member = value;
+  }
+}
+
+void ViewProps::setColdPropsFromRawProps(
+    const PropsParserContext &context,
+    RawProps const &rawProps) {
+  if (rawProps.isEmpty()) {
+    return;
+  }
+
+  // Most props objects do not specify any of the props (or specify the same
+  // values as the source props), so the values are parsed one by one and the
+  // instance shared with the source props is copied only if one changes.
+  setColdProp(
+      *this,
+      &ViewColdProps::borderRadii,
+      convertRawProp(
+          context, rawProps, "border", "Radius", coldProps_->borderRadii, {}));
+  setColdProp(
+      *this,
+      &ViewColdProps::borderColors,
+      convertRawProp(
+          context, rawProps, "border", "Color", coldProps_->borderColors, {}));
+  setColdProp(
+      *this,
+      &ViewColdProps::borderStyles,
+      convertRawProp(
+          context, rawProps, "border", "Style", coldProps_->borderStyles, {}));
+  setColdProp(
+      *this,
+      &ViewColdProps::shadowColor,
+      convertRawProp(
+          context, rawProps, "shadowColor", coldProps_->shadowColor, {}));
+  setColdProp(
+      *this,
+      &ViewColdProps::shadowOffset,
+      convertRawProp(
+          context, rawProps, "shadowOffset", coldProps_->shadowOffset, {}));
+  setColdProp(
+      *this,
+      &ViewColdProps::shadowOpacity,
+      convertRawProp(
+          context, rawProps, "shadowOpacity", coldProps_->shadowOpacity, {}));
+  setColdProp(
+      *this,
+      &ViewColdProps::shadowRadius,
+      convertRawProp(
+          context, rawProps, "shadowRadius", coldProps_->shadowRadius, {}));
+  setColdProp(
+      *this,
+      &ViewColdProps::hitSlop,
+      convertRawProp(context, rawProps, "hitSlop", coldProps_->hitSlop, {}));
+#ifdef ANDROID
+  setColdProp(
+      *this,
+      &ViewColdProps::nativeBackground,
+      convertRawProp(
+          context,
+          rawProps,
+          "nativeBackgroundAndroid",
+          coldProps_->nativeBackground,
+          {}));
+  setColdProp(
+      *this,
+      &ViewColdProps::nativeForeground,
+      convertRawProp(
+          context,
+          rawProps,
+          "nativeForegroundAndroid",
+          coldProps_->nativeForeground,
+          {}));
+#endif
+}
+
+ViewColdProps const &ViewProps::coldProps() const {
+  return *coldProps_;
+}
+
+ViewColdProps &ViewProps::mutableColdProps() {
+  if (coldProps_.use_count() != 1) {
+    coldProps_ = std::make_shared<ViewColdProps const>(*coldProps_);
+  }
+  return const_cast<ViewColdProps &>(*coldProps_);
+}
 
 #pragma mark - Convenience Methods
 
@@ -247,11 +327,12 @@ BorderMetrics ViewProps::resolveBorderMetrics(
   };
 
   return {
-      /* .borderColors = */ borderColors.resolve(isRTL, {}),
+      /* .borderColors = */ borderColors().resolve(isRTL, {}),
       /* .borderWidths = */ borderWidths.resolve(isRTL, 0),
       /* .borderRadii = */
-      ensureNoOverlap(borderRadii.resolve(isRTL, 0), layoutMetrics.frame.size),
-      /* .borderStyles = */ borderStyles.resolve(isRTL, BorderStyle::Solid),
+      ensureNoOverlap(
+          borderRadii().resolve(isRTL, 0), layoutMetrics.frame.size),
+      /* .borderStyles = */ borderStyles().resolve(isRTL, BorderStyle::Solid),
   };
 }
 
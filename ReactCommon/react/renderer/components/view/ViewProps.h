@@ -17,6 +17,7 @@
 #include <react/renderer/graphics/Geometry.h>
 #include <react/renderer/graphics/Transform.h>
 
+#include <memory>
 #include <optional>
 
 namespace facebook {
@@ -24,6 +25,39 @@ namespace react {
 
 class ViewProps;
 
+/*
+ * Props of `ViewProps` which are rarely specified and therefore usually have
+ * default values. They are stored out of line and shared (copy-on-write)
+ * among `ViewProps` objects: all props objects which do not specify any of
+ * them share a single default instance, and clones which do not change them
+ * share the instance of the source props.
+ */
+struct ViewColdProps final {
+  // Borders
+  CascadedBorderRadii borderRadii{};
+  CascadedBorderColors borderColors{};
+  CascadedBorderStyles borderStyles{};
+
+  // Shadow
+  SharedColor shadowColor{};
+  Size shadowOffset{0, -3};
+  Float shadowOpacity{};
+  Float shadowRadius{3};
+
+  // Events
+  EdgeInsets hitSlop{};
+
+#ifdef ANDROID
+
+  std::optional<NativeDrawable> nativeBackground{};
+  std::optional<NativeDrawable> nativeForeground{};
+
+#endif
+
+  bool operator==(ViewColdProps const &rhs) const;
+  bool operator!=(ViewColdProps const &rhs) const;
+};
+
 using SharedViewProps = std::shared_ptr<ViewProps const>;
 
 class ViewProps : public YogaStylableProps, public AccessibilityProps {
@@ -43,15 +77,29 @@ class ViewProps : public YogaStylableProps, public AccessibilityProps {
   SharedColor backgroundColor{};
 
   // Borders
-  CascadedBorderRadii borderRadii{};
-  CascadedBorderColors borderColors{};
-  CascadedBorderStyles borderStyles{};
+  CascadedBorderRadii const &borderRadii() const {
+    return coldProps_->borderRadii;
+  }
+  CascadedBorderColors const &borderColors() const {
+    return coldProps_->borderColors;
+  }
+  CascadedBorderStyles const &borderStyles() const {
+    return coldProps_->borderStyles;
+  }
 
   // Shadow
-  SharedColor shadowColor{};
-  Size shadowOffset{0, -3};
-  Float shadowOpacity{};
-  Float shadowRadius{3};
+  SharedColor const &shadowColor() const {
+    return coldProps_->shadowColor;
+  }
+  Size const &shadowOffset() const {
+    return coldProps_->shadowOffset;
+  }
+  Float shadowOpacity() const {
+    return coldProps_->shadowOpacity;
+  }
+  Float shadowRadius() const {
+    return coldProps_->shadowRadius;
+  }
 
   // Transform
   Transform transform{};
@@ -61,7 +109,9 @@ class ViewProps : public YogaStylableProps, public AccessibilityProps {
 
   // Events
   PointerEventsMode pointerEvents{};
-  EdgeInsets hitSlop{};
+  EdgeInsets const &hitSlop() const {
+    return coldProps_->hitSlop;
+  }
   bool onLayout{};
 
   ViewEvents events{};
@@ -74,8 +124,12 @@ class ViewProps : public YogaStylableProps, public AccessibilityProps {
 
 #ifdef ANDROID
 
-  std::optional<NativeDrawable> nativeBackground{};
-  std::optional<NativeDrawable> nativeForeground{};
+  std::optional<NativeDrawable> const &nativeBackground() const {
+    return coldProps_->nativeBackground;
+  }
+  std::optional<NativeDrawable> const &nativeForeground() const {
+    return coldProps_->nativeForeground;
+  }
 
   bool focusable{false};
   bool hasTVPreferredFocus{false};
@@ -84,6 +138,21 @@ class ViewProps : public YogaStylableProps, public AccessibilityProps {
 
 #endif
 
+#pragma mark - Cold Props
+
+  /*
+   * Rarely specified props (see `ViewColdProps`).
+   */
+  ViewColdProps const &coldProps() const;
+
+  /*
+   * Returns rarely specified props of this object for mutation, copying them
+   * first if they are shared with other props objects.
+   * Must only be used by code that mutates props objects right after
+   * construction (and must be accompanied by `changeSet.invalidate()`).
+   */
+  ViewColdProps &mutableColdProps();
+
 #pragma mark - Convenience Methods
 
   BorderMetrics resolveBorderMetrics(LayoutMetrics const &layoutMetrics) const;
@@ -98,6 +167,19 @@ class ViewProps : public YogaStylableProps, public AccessibilityProps {
 #if RN_DEBUG_STRING_CONVERTIBLE
   SharedDebugStringConvertibleList getDebugProps() const override;
 #endif
+
+ private:
+  static std::shared_ptr<ViewColdProps const> const &defaultColdProps();
+
+  /*
+   * Parses the cold props of `rawProps` into `coldProps_` (which initially is
+   * the instance of the source props).
+   */
+  void setColdPropsFromRawProps(
+      const PropsParserContext &context,
+      RawProps const &rawProps);
+
+  std::shared_ptr<ViewColdProps const> coldProps_{defaultColdProps()};
 };
 
 } // namespace react
@@ -36,6 +36,9 @@ static inline void interpolateViewProps(
   interpolatedProps->transform = Transform::Interpolate(
       animationProgress, oldViewProps->transform, newViewProps->transform);
 
+  // The props were mutated after construction.
+  interpolatedProps->changeSet.invalidate();
+
   // Android uses RawProps, not props, to update props on the platform...
   // Since interpolated props don't interpolate at all using RawProps, we need
   // to "re-hydrate" raw props after interpolating. This is what actually gets
@@ -71,7 +71,7 @@ void ViewShadowNode::initialize() noexcept {
        viewProps.yogaStyle.positionType() != YGPositionTypeStatic) ||
       viewProps.yogaStyle.display() == YGDisplayNone ||
       viewProps.getClipsContentToBounds() ||
-      isColorMeaningful(viewProps.shadowColor) ||
+      isColorMeaningful(viewProps.shadowColor()) ||
       viewProps.accessibilityElementsHidden ||
       viewProps.accessibilityViewIsModal ||
       viewProps.importantForAccessibility != ImportantForAccessibility::Auto ||
@@ -89,8 +89,8 @@ void ViewShadowNode::initialize() noexcept {
       !viewProps.testId.empty();
 
 #ifdef ANDROID
-  formsView = formsView || viewProps.nativeBackground.has_value() ||
-      viewProps.nativeForeground.has_value() || viewProps.focusable ||
+  formsView = formsView || viewProps.nativeBackground().has_value() ||
+      viewProps.nativeForeground().has_value() || viewProps.focusable ||
       viewProps.hasTVPreferredFocus ||
       viewProps.needsOffscreenAlphaCompositing ||
       viewProps.renderToHardwareTextureAndroid;
@@ -11,8 +11,10 @@
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/components/view/ViewProps.h>
 #include <react/renderer/components/view/conversions.h>
+#include <react/renderer/core/ComponentDescriptor.h>
 #include <react/renderer/core/LayoutConstraints.h>
 #include <react/renderer/core/LayoutContext.h>
+#include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/debug/DebugStringConvertibleItem.h>
 #include <react/renderer/debug/SystraceSection.h>
 #include <yoga/Yoga.h>
@@ -695,50 +697,97 @@ void YogaLayoutableShadowNode::swapLeftAndRightInYogaStyleProps(
   shadowNode.yogaNode_.setStyle(yogaStyle);
 }
 
+/*
+ * Returns `true` if `swapLeftAndRightInViewProps` would change the props.
+ */
+static bool hasLeftOrRightViewProps(ViewProps const &props) {
+  auto const &coldProps = props.coldProps();
+  auto const &border = props.yogaStyle.border();
+  return coldProps.borderRadii.topLeft.has_value() ||
+      coldProps.borderRadii.bottomLeft.has_value() ||
+      coldProps.borderRadii.topRight.has_value() ||
+      coldProps.borderRadii.bottomRight.has_value() ||
+      coldProps.borderColors.left.has_value() ||
+      coldProps.borderColors.right.has_value() ||
+      coldProps.borderStyles.left.has_value() ||
+      coldProps.borderStyles.right.has_value() ||
+      !border[YGEdgeLeft].isUndefined() ||
+      !border[YGEdgeRight].isUndefined();
+}
+
 void YogaLayoutableShadowNode::swapLeftAndRightInViewProps(
     YogaLayoutableShadowNode const &shadowNode) {
-  auto &typedCasting = static_cast<ViewProps const &>(*shadowNode.props_);
-  auto &props = const_cast<ViewProps &>(typedCasting);
+  if (!hasLeftOrRightViewProps(
+          static_cast<ViewProps const &>(*shadowNode.props_))) {
+    return;
+  }
+
+  // The props object is shared with other revisions of the node (and, with
+  // props interning, with other nodes), so the values are swapped in a copy
+  // which replaces the props of the node. Once swapped, there is nothing left
+  // to swap, so subsequent layout passes do not copy the props again.
+  // Empty raw props are not parsed, so the context container (which is
+  // optional for component descriptors) is not consulted.
+  static ContextContainer const emptyContextContainer{};
+  auto const &componentDescriptor = shadowNode.getComponentDescriptor();
+  auto const &contextContainer = componentDescriptor.getContextContainer();
+  auto propsParserContext = PropsParserContext{
+      shadowNode.getSurfaceId(),
+      contextContainer ? *contextContainer : emptyContextContainer};
+  auto clonedProps = componentDescriptor.cloneProps(
+      propsParserContext, shadowNode.props_, RawProps{});
+  auto &props =
+      const_cast<ViewProps &>(static_cast<ViewProps const &>(*clonedProps));
+
+  // Props are mutated below; the set of changed keys no longer describes them.
+  props.changeSet.invalidate();
 
   // Swap border node values, borderRadii, borderColors and borderStyles.
-  if (props.borderRadii.topLeft.has_value()) {
-    props.borderRadii.topStart = props.borderRadii.topLeft;
-    props.borderRadii.topLeft.reset();
+  // Cold props are shared with other props objects, so they are copied only
+  // if something is swapped.
+  auto coldProps = props.coldProps();
+  if (coldProps.borderRadii.topLeft.has_value()) {
+    coldProps.borderRadii.topStart = coldProps.borderRadii.topLeft;
+    coldProps.borderRadii.topLeft.reset();
   }
 
-  if (props.borderRadii.bottomLeft.has_value()) {
-    props.borderRadii.bottomStart = props.borderRadii.bottomLeft;
-    props.borderRadii.bottomLeft.reset();
+  if (coldProps.borderRadii.bottomLeft.has_value()) {
+    coldProps.borderRadii.bottomStart = coldProps.borderRadii.bottomLeft;
+    coldProps.borderRadii.bottomLeft.reset();
   }
 
-  if (props.borderRadii.topRight.has_value()) {
-    props.borderRadii.topEnd = props.borderRadii.topRight;
-    props.borderRadii.topRight.reset();
+  if (coldProps.borderRadii.topRight.has_value()) {
+    coldProps.borderRadii.topEnd = coldProps.borderRadii.topRight;
+    coldProps.borderRadii.topRight.reset();
   }
 
-  if (props.borderRadii.bottomRight.has_value()) {
-    props.borderRadii.bottomEnd = props.borderRadii.bottomRight;
-    props.borderRadii.bottomRight.reset();
+  if (coldProps.borderRadii.bottomRight.has_value()) {
+    coldProps.borderRadii.bottomEnd = coldProps.borderRadii.bottomRight;
+    coldProps.borderRadii.bottomRight.reset();
   }
 
-  if (props.borderColors.left.has_value()) {
-    props.borderColors.start = props.borderColors.left;
-    props.borderColors.left.reset();
+  if (coldProps.borderColors.left.has_value()) {
+    coldProps.borderColors.start = coldProps.borderColors.left;
+    coldProps.borderColors.left.reset();
   }
 
-  if (props.borderColors.right.has_value()) {
-    props.borderColors.end = props.borderColors.right;
-    props.borderColors.right.reset();
+  if (coldProps.borderColors.right.has_value()) {
+    coldProps.borderColors.end = coldProps.borderColors.right;
+    coldProps.borderColors.right.reset();
   }
 
-  if (props.borderStyles.left.has_value()) {
-    props.borderStyles.start = props.borderStyles.left;
-    props.borderStyles.left.reset();
+  if (coldProps.borderStyles.left.has_value()) {
+    coldProps.borderStyles.start = coldProps.borderStyles.left;
+    coldProps.borderStyles.left.reset();
   }
 
-  if (props.borderStyles.right.has_value()) {
-    props.borderStyles.end = props.borderStyles.right;
-    props.borderStyles.right.reset();
+  if (coldProps.borderStyles.right.has_value()) {
+    coldProps.borderStyles.end = coldProps.borderStyles.right;
+    coldProps.borderStyles.right.reset();
+  }
+
+  if (coldProps != props.coldProps()) {
+    props.mutableColdProps() = coldProps;
   }
 
   YGStyle::Edges const &border = props.yogaStyle.border();
@@ -752,6 +801,9 @@ void YogaLayoutableShadowNode::swapLeftAndRightInViewProps(
     props.yogaStyle.border()[YGEdgeEnd] = border[YGEdgeRight];
     props.yogaStyle.border()[YGEdgeRight] = YGValueUndefined;
   }
+
+  const_cast<YogaLayoutableShadowNode &>(shadowNode).props_ =
+      std::move(clonedProps);
 }
 
 #pragma mark - Consistency Ensuring Helpers
@@ -359,5 +359,66 @@ TEST_F(LayoutTest, overflowInsetTransformScaleTest) {
   EXPECT_EQ(layoutMetricsABC.overflowInset.bottom, 0);
 }
 
+TEST_F(LayoutTest, swapLeftAndRightDoesNotMutateSharedProps) {
+  // Both views share the very same props object (as they do with props
+  // interning, or with previous revisions of the same node).
+  auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+  sharedProps->yogaStyle.positionType() = YGPositionTypeAbsolute;
+  sharedProps->yogaStyle.dimensions()[YGDimensionWidth] =
+      YGValue{50, YGUnitPoint};
+  sharedProps->yogaStyle.dimensions()[YGDimensionHeight] =
+      YGValue{50, YGUnitPoint};
+  sharedProps->yogaStyle.border()[YGEdgeLeft] = YGValue{5, YGUnitPoint};
+  sharedProps->mutableColdProps().borderRadii.topLeft = 4;
+
+  std::shared_ptr<ViewShadowNode> viewShadowNodeA;
+  std::shared_ptr<ViewShadowNode> viewShadowNodeB;
+
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .reference(rootShadowNode_)
+        .tag(1)
+        .props([] {
+          auto sharedProps = std::make_shared<RootProps>();
+          auto &props = *sharedProps;
+          props.layoutConstraints = LayoutConstraints{{0,0}, {500, 500}};
+          props.layoutContext.swapLeftAndRightInRTL = true;
+          return sharedProps;
+        })
+        .children({
+          Element<ViewShadowNode>()
+            .reference(viewShadowNodeA)
+            .tag(2)
+            .props([=] { return sharedProps; }),
+          Element<ViewShadowNode>()
+            .reference(viewShadowNodeB)
+            .tag(3)
+            .props([=] { return sharedProps; })
+        });
+  // clang-format on
+
+  builder_.build(element);
+  rootShadowNode_->layoutIfNeeded();
+
+  auto const &sharedYogaStyle = sharedProps->yogaStyle;
+  EXPECT_FALSE(sharedYogaStyle.border()[YGEdgeLeft].isUndefined());
+  EXPECT_TRUE(sharedYogaStyle.border()[YGEdgeStart].isUndefined());
+  EXPECT_TRUE(sharedProps->borderRadii().topLeft.has_value());
+  EXPECT_FALSE(sharedProps->borderRadii().topStart.has_value());
+
+  for (auto const &viewShadowNode : {viewShadowNodeA, viewShadowNodeB}) {
+    EXPECT_NE(viewShadowNode->getProps(), sharedProps);
+
+    auto const &props =
+        static_cast<ViewProps const &>(*viewShadowNode->getProps());
+    auto const &yogaStyle = props.yogaStyle;
+    EXPECT_TRUE(yogaStyle.border()[YGEdgeLeft].isUndefined());
+    EXPECT_FALSE(yogaStyle.border()[YGEdgeStart].isUndefined());
+    EXPECT_FALSE(props.borderRadii().topLeft.has_value());
+    EXPECT_TRUE(props.borderRadii().topStart.has_value());
+  }
+}
+
 } // namespace react
 } // namespace facebook
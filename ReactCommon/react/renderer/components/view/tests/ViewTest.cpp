@@ -19,6 +19,7 @@
 
 #include <react/renderer/element/Element.h>
 #include <react/renderer/element/testUtils.h>
+#include <react/utils/ContextContainer.h>
 
 namespace facebook {
 namespace react {
@@ -227,5 +228,55 @@ TEST_F(YogaDirtyFlagTest, updatingStateForScrollViewMistNotDirtyYogaNode) {
       static_cast<RootShadowNode &>(*newRootShadowNode).layoutIfNeeded());
 }
 
+TEST(ViewPropsTest, coldPropsAreSharedAndCopiedOnWrite) {
+  auto contextContainer = std::make_shared<ContextContainer const>();
+  auto componentDescriptor =
+      ViewComponentDescriptor{ComponentDescriptorParameters{
+          EventDispatcher::Shared{}, contextContainer, nullptr}};
+
+  auto parserContextContainer = ContextContainer{};
+  auto parserContext = PropsParserContext{-1, parserContextContainer};
+
+  auto cloneProps = [&](Props::Shared const &sourceProps,
+                        folly::dynamic const &dynamic) {
+    const auto &rawProps = RawProps(dynamic);
+    return std::static_pointer_cast<ViewProps const>(
+        componentDescriptor.cloneProps(parserContext, sourceProps, rawProps));
+  };
+
+  /*
+   * Props which do not specify any cold props share the default instance.
+   */
+  auto propsA = cloneProps(nullptr, folly::dynamic::object("opacity", 0.5));
+  auto propsB = cloneProps(nullptr, folly::dynamic::object("nativeID", "B"));
+  EXPECT_EQ(&propsA->coldProps(), &propsB->coldProps());
+
+  /*
+   * Specifying a cold prop does not affect the source props.
+   */
+  auto propsC = cloneProps(propsA, folly::dynamic::object("shadowRadius", 10));
+  EXPECT_NE(&propsA->coldProps(), &propsC->coldProps());
+  EXPECT_EQ(propsC->shadowRadius(), 10);
+  EXPECT_EQ(propsA->shadowRadius(), 3);
+
+  /*
+   * Clones which do not change cold props (or set them to the same values)
+   * share the instance of the source props.
+   */
+  auto propsD = cloneProps(propsC, folly::dynamic::object("opacity", 0.7));
+  EXPECT_EQ(&propsC->coldProps(), &propsD->coldProps());
+  auto propsF = cloneProps(propsC, folly::dynamic::object("shadowRadius", 10));
+  EXPECT_EQ(&propsC->coldProps(), &propsF->coldProps());
+
+  /*
+   * Mutating cold props of a props object copies them first.
+   */
+  auto propsE = std::make_shared<ViewProps>(*propsD);
+  propsE->mutableColdProps().shadowRadius = 20;
+  EXPECT_EQ(propsE->shadowRadius(), 20);
+  EXPECT_EQ(propsD->shadowRadius(), 10);
+  EXPECT_EQ(propsC->shadowRadius(), 10);
+}
+
 } // namespace react
 } // namespace facebook
@@ -21,5 +21,9 @@ ContextContainer::Shared const &ComponentDescriptor::getContextContainer()
   return contextContainer_;
 }
 
+void ComponentDescriptor::setPropsInterningEnabled(bool enabled) const {
+  propsInterner_.setEnabled(enabled);
+}
+
 } // namespace react
 } // namespace facebook
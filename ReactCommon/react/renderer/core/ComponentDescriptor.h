@@ -10,6 +10,7 @@
 #include <react/renderer/core/EventDispatcher.h>
 #include <react/renderer/core/Props.h>
 #include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/core/PropsInterner.h>
 #include <react/renderer/core/RawPropsParser.h>
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/core/State.h>
@@ -107,6 +108,14 @@ class ComponentDescriptor {
       const SharedProps &props,
       const RawProps &rawProps) const = 0;
 
+  /*
+   * Enables interning of props objects created by `cloneProps` from
+   * non-empty `RawProps`: identical inputs resolve to one shared props object
+   * (see `PropsInterner`). Disabled by default. Has no effect on Android,
+   * where `Props::rawProps` of a props object is updated after construction.
+   */
+  void setPropsInterningEnabled(bool enabled) const;
+
   /*
    * Creates a new `Props` of a particular type with all values interpolated
    * between `props` and `newProps`.
@@ -144,6 +153,7 @@ class ComponentDescriptor {
   EventDispatcher::Weak eventDispatcher_;
   ContextContainer::Shared contextContainer_;
   RawPropsParser rawPropsParser_{};
+  PropsInterner propsInterner_{};
   Flavor flavor_;
 };
 
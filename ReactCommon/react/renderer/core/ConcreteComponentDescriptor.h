@@ -109,6 +109,14 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
 
     rawProps.parse(rawPropsParser_, context);
 
+#ifndef ANDROID
+    if (propsInterner_.isEnabled()) {
+      return propsInterner_.intern(context, props, rawProps, [&]() {
+        return ShadowNodeT::Props(context, rawProps, props);
+      });
+    }
+#endif
+
     return ShadowNodeT::Props(context, rawProps, props);
   };
 
@@ -109,6 +109,34 @@ void EventEmitter::dispatchUniqueEvent(
       RawEvent::Category::Continuous));
 }
 
+void EventEmitter::dispatchEventBatch(
+    std::string type,
+    std::vector<SharedEventTarget> eventTargets,
+    RawEvent::BatchedValueFactory payloadFactory,
+    EventPriority priority) const {
+  SystraceSection s(
+      "EventEmitter::dispatchEventBatch",
+      "type",
+      type,
+      "size",
+      eventTargets.size());
+
+  auto eventDispatcher = eventDispatcher_.lock();
+  if (!eventDispatcher) {
+    return;
+  }
+
+  auto rawEvent =
+      RawEvent(normalizeEventType(std::move(type)), ValueFactory{}, nullptr);
+  rawEvent.batchedEventTargets = std::move(eventTargets);
+  rawEvent.batchedPayloadFactory = std::move(payloadFactory);
+  eventDispatcher->dispatchEvent(std::move(rawEvent), priority);
+}
+
+SharedEventTarget const &EventEmitter::getEventTarget() const {
+  return eventTarget_;
+}
+
 void EventEmitter::setEnabled(bool enabled) const {
   enableCounter_ += enabled ? 1 : -1;
 
@@ -9,6 +9,7 @@
 
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include <folly/dynamic.h>
 #include <react/renderer/core/EventDispatcher.h>
@@ -88,6 +89,24 @@ class EventEmitter {
       const ValueFactory &payloadFactory =
           EventEmitter::defaultPayloadFactory()) const;
 
+  /*
+   * Initiates a delivery process of a batch of events of the same type (see
+   * `RawEvent::batchedEventTargets`) via the event dispatcher of this emitter.
+   * The targets usually belong to other emitters (see `getEventTarget`).
+   * Is used by particular subclasses only.
+   */
+  void dispatchEventBatch(
+      std::string type,
+      std::vector<SharedEventTarget> eventTargets,
+      RawEvent::BatchedValueFactory payloadFactory,
+      EventPriority priority = EventPriority::AsynchronousBatched) const;
+
+  /*
+   * Returns the event target of the emitter; `nullptr` if the emitter is
+   * disabled.
+   */
+  SharedEventTarget const &getEventTarget() const;
+
  private:
   void toggleEventTargetOwnership_() const;
 
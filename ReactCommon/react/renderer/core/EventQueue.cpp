@@ -7,17 +7,27 @@
 
 #include "EventQueue.h"
 
+#include <algorithm>
+
 #include "EventEmitter.h"
 #include "ShadowNodeFamily.h"
 
 namespace facebook {
 namespace react {
 
+/*
+ * Number of event slots above which stale slots are dropped.
+ * The threshold grows with the number of live slots so that pruning stays
+ * amortized O(1) per enqueued event.
+ */
+static constexpr size_t kMinimumEventSlotsPruneThreshold = 64;
+
 EventQueue::EventQueue(
     EventQueueProcessor eventProcessor,
     std::unique_ptr<EventBeat> eventBeat)
     : eventProcessor_(std::move(eventProcessor)),
-      eventBeat_(std::move(eventBeat)) {
+      eventBeat_(std::move(eventBeat)),
+      eventSlotsPruneThreshold_(kMinimumEventSlotsPruneThreshold) {
   eventBeat_->setBeatCallback(
       [this](jsi::Runtime &runtime) { onBeat(runtime); });
 }
@@ -25,7 +35,7 @@ EventQueue::EventQueue(
 void EventQueue::enqueueEvent(RawEvent &&rawEvent) const {
   {
     std::lock_guard<std::mutex> lock(queueMutex_);
-    eventQueue_.push_back(std::move(rawEvent));
+    pushEvent(std::move(rawEvent), false);
   }
 
   onEnqueue();
@@ -34,28 +44,7 @@ void EventQueue::enqueueEvent(RawEvent &&rawEvent) const {
 void EventQueue::enqueueUniqueEvent(RawEvent &&rawEvent) const {
   {
     std::lock_guard<std::mutex> lock(queueMutex_);
-
-    auto repeatedEvent = eventQueue_.rend();
-
-    for (auto it = eventQueue_.rbegin(); it != eventQueue_.rend(); ++it) {
-      if (it->type == rawEvent.type &&
-          it->eventTarget == rawEvent.eventTarget) {
-        repeatedEvent = it;
-        break;
-      } else if (it->eventTarget == rawEvent.eventTarget) {
-        // It is necessary to maintain order of different event types
-        // for the same target. If the same target has event types A1, B1
-        // in the event queue and event A2 occurs. A1 has to stay in the
-        // queue.
-        break;
-      }
-    }
-
-    if (repeatedEvent == eventQueue_.rend()) {
-      eventQueue_.push_back(std::move(rawEvent));
-    } else {
-      *repeatedEvent = std::move(rawEvent);
-    }
+    pushEvent(std::move(rawEvent), true);
   }
 
   onEnqueue();
@@ -87,12 +76,15 @@ void EventQueue::flushEvents(jsi::Runtime &runtime) const {
   {
     std::lock_guard<std::mutex> lock(queueMutex_);
 
-    if (eventQueue_.size() == 0) {
+    if (eventQueue_.empty()) {
       return;
     }
 
     queue = std::move(eventQueue_);
     eventQueue_.clear();
+
+    // Makes all slots stale at once.
+    flushCount_ += 1;
   }
 
   eventProcessor_.flushEvents(runtime, std::move(queue));
@@ -115,5 +107,60 @@ void EventQueue::flushStateUpdates() const {
   eventProcessor_.flushStateUpdates(std::move(stateUpdateQueue));
 }
 
+#pragma mark - Private
+
+void EventQueue::pushEvent(RawEvent &&rawEvent, bool isUnique) const {
+  auto index = eventQueue_.size();
+
+  if (!rawEvent.batchedEventTargets.empty()) {
+    eventQueue_.push_back(std::move(rawEvent));
+
+    // A batch is the last queued event of each of its targets (so the rule
+    // below applies to them), but is never replaced as a whole.
+    for (auto const &eventTarget : eventQueue_.back().batchedEventTargets) {
+      eventSlots_[eventTarget.get()] = EventSlot{flushCount_, index, false};
+    }
+  } else {
+    // The queued event retains its target, so the pointer of the target is
+    // not reused while the slot is not stale.
+    auto [it, isNewSlot] =
+        eventSlots_.try_emplace(rawEvent.eventTarget.get());
+    auto &eventSlot = it->second;
+
+    // Only the last event queued for the target may be replaced: it is
+    // necessary to maintain order of different event types for the same
+    // target. If the same target has event types A1, B1 in the event queue
+    // and event A2 occurs, A1 has to stay in the queue.
+    if (isUnique && !isNewSlot && eventSlot.flushCount == flushCount_ &&
+        eventSlot.isReplaceable &&
+        eventQueue_[eventSlot.index].type == rawEvent.type) {
+      eventQueue_[eventSlot.index] = std::move(rawEvent);
+      return;
+    }
+
+    eventSlot = EventSlot{flushCount_, index, true};
+    eventQueue_.push_back(std::move(rawEvent));
+  }
+
+  pruneEventSlotsIfNeeded();
+}
+
+void EventQueue::pruneEventSlotsIfNeeded() const {
+  if (eventSlots_.size() < eventSlotsPruneThreshold_) {
+    return;
+  }
+
+  for (auto it = eventSlots_.begin(); it != eventSlots_.end();) {
+    if (it->second.flushCount != flushCount_) {
+      it = eventSlots_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  eventSlotsPruneThreshold_ =
+      std::max(kMinimumEventSlotsPruneThreshold, eventSlots_.size() * 2);
+}
+
 } // namespace react
 } // namespace facebook
@@ -9,6 +9,7 @@
 
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include <jsi/jsi.h>
@@ -23,6 +24,10 @@ namespace react {
 /*
  * Event Queue synchronized with given Event Beat and dispatching event
  * using given Event Pipe.
+ *
+ * Producers keep an index of the last queued event per target which makes
+ * coalescing of unique events O(1). `flushEvents` takes the queue with a
+ * constant-time swap, so enqueueing never waits for events to be processed.
  */
 class EventQueue {
  public:
@@ -39,7 +44,9 @@ class EventQueue {
 
   /*
    * Enqueues and (probably later) dispatches a given event.
-   * Deletes last RawEvent from the queue if it has the same type and target.
+   * Replaces the last RawEvent in the queue if it has the same type and
+   * target and no event of another type for the target follows it. Batched
+   * events count as events of each of their targets and are never replaced.
    * Can be called on any thread.
    */
   void enqueueUniqueEvent(RawEvent &&rawEvent) const;
@@ -70,6 +77,45 @@ class EventQueue {
   mutable std::vector<StateUpdate> stateUpdateQueue_;
   mutable std::mutex queueMutex_;
   mutable bool hasContinuousEventStarted_{false};
+
+ private:
+  /*
+   * The last event queued for a target.
+   */
+  struct EventSlot {
+    /*
+     * Value of `flushCount_` when the event was queued; the slot is stale
+     * once the event has been flushed.
+     */
+    size_t flushCount;
+    /*
+     * Position of the event in `eventQueue_`.
+     */
+    size_t index;
+    /*
+     * `false` if the event is a batch (see `RawEvent::batchedEventTargets`).
+     */
+    bool isReplaceable;
+  };
+
+  /*
+   * Queues the event or, if `isUnique`, replaces the last queued event with
+   * the same type and target. A batch of events counts as the last queued
+   * event of each of its targets.
+   * Must be called with `queueMutex_` held.
+   */
+  void pushEvent(RawEvent &&rawEvent, bool isUnique) const;
+
+  /*
+   * Drops stale slots.
+   * Must be called with `queueMutex_` held.
+   */
+  void pruneEventSlotsIfNeeded() const;
+
+  // Protected by `queueMutex_`.
+  mutable std::unordered_map<EventTarget const *, EventSlot> eventSlots_;
+  mutable size_t eventSlotsPruneThreshold_;
+  mutable size_t flushCount_{0};
 };
 
 } // namespace react
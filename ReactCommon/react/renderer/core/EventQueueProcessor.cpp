@@ -28,6 +28,11 @@ void EventQueueProcessor::flushEvents(
       if (event.eventTarget) {
         event.eventTarget->retain(runtime);
       }
+      for (const auto &eventTarget : event.batchedEventTargets) {
+        if (eventTarget) {
+          eventTarget->retain(runtime);
+        }
+      }
     }
   }
 
@@ -48,12 +53,26 @@ void EventQueueProcessor::flushEvents(
       reactPriority = ReactEventPriority::Discrete;
     }
 
-    eventPipe_(
-        runtime,
-        event.eventTarget.get(),
-        event.type,
-        reactPriority,
-        event.payloadFactory);
+    if (event.batchedEventTargets.empty()) {
+      eventPipe_(
+          runtime,
+          event.eventTarget.get(),
+          event.type,
+          reactPriority,
+          event.payloadFactory);
+    } else {
+      auto const &batchedEventTargets = event.batchedEventTargets;
+      for (size_t index = 0; index < batchedEventTargets.size(); index++) {
+        eventPipe_(
+            runtime,
+            batchedEventTargets[index].get(),
+            event.type,
+            reactPriority,
+            [&](jsi::Runtime &runtime) {
+              return event.batchedPayloadFactory(runtime, index);
+            });
+      }
+    }
 
     if (event.category == RawEvent::Category::ContinuousStart) {
       hasContinuousEventStarted_ = true;
@@ -68,6 +87,11 @@ void EventQueueProcessor::flushEvents(
     if (event.eventTarget) {
       event.eventTarget->release(runtime);
     }
+    for (const auto &eventTarget : event.batchedEventTargets) {
+      if (eventTarget) {
+        eventTarget->release(runtime);
+      }
+    }
   }
 }
 
@@ -11,6 +11,7 @@
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/LayoutMetrics.h>
 #include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/core/ShadowNodeAncestorIndex.h>
 #include <react/renderer/debug/DebugStringConvertibleItem.h>
 #include <react/renderer/graphics/conversions.h>
 
@@ -33,7 +34,8 @@ LayoutableShadowNode::LayoutableShadowNode(
 LayoutMetrics LayoutableShadowNode::computeRelativeLayoutMetrics(
     ShadowNodeFamily const &descendantNodeFamily,
     LayoutableShadowNode const &ancestorNode,
-    LayoutInspectingPolicy policy) {
+    LayoutInspectingPolicy policy,
+    ShadowNodeAncestorIndex const *ancestorIndex) {
   if (&descendantNodeFamily == &ancestorNode.getFamily()) {
     // Layout metrics of a node computed relatively to the same node are equal
     // to `transform`-ed layout metrics of the node with zero `origin`.
@@ -45,7 +47,9 @@ LayoutMetrics LayoutableShadowNode::computeRelativeLayoutMetrics(
     return layoutMetrics;
   }
 
-  auto ancestors = descendantNodeFamily.getAncestors(ancestorNode);
+  auto ancestors = ancestorIndex
+      ? ancestorIndex->getAncestors(descendantNodeFamily, ancestorNode)
+      : descendantNodeFamily.getAncestors(ancestorNode);
 
   if (ancestors.size() == 0) {
     // Specified nodes do not form an ancestor-descender relationship
@@ -149,6 +153,7 @@ void LayoutableShadowNode::setLayoutMetrics(LayoutMetrics layoutMetrics) {
   }
 
   layoutMetrics_ = layoutMetrics;
+  invalidateMountGeneration();
 }
 
 Transform LayoutableShadowNode::getTransform() const {
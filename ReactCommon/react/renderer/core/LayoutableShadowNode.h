@@ -26,6 +26,7 @@ namespace react {
 
 struct LayoutConstraints;
 struct LayoutContext;
+class ShadowNodeAncestorIndex;
 
 /*
  * Describes all sufficient layout API (in approach-agnostic way)
@@ -57,11 +58,14 @@ class LayoutableShadowNode : public ShadowNode {
    * computed relatively to given `ancestorNode`. Returns `EmptyLayoutMetrics`
    * if the nodes don't form an ancestor-descender relationship in the same
    * tree.
+   * If `ancestorIndex` is provided, the path between the nodes is looked up
+   * in it (see `ShadowNodeAncestorIndex`).
    */
   static LayoutMetrics computeRelativeLayoutMetrics(
       ShadowNodeFamily const &descendantNodeFamily,
       LayoutableShadowNode const &ancestorNode,
-      LayoutInspectingPolicy policy);
+      LayoutInspectingPolicy policy,
+      ShadowNodeAncestorIndex const *ancestorIndex = nullptr);
 
   /*
    * Performs layout of the tree starting from this node. Usually is being
@@ -24,7 +24,8 @@ Props::Props(
           "nativeID",
           sourceProps.nativeId,
           {})),
-      revision(sourceProps.revision + 1)
+      revision(sourceProps.revision + 1),
+      changeSet(sourceProps.changeSet, rawProps)
 #ifdef ANDROID
       ,
       rawProps(
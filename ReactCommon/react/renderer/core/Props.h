@@ -9,6 +9,7 @@
 
 #include <folly/dynamic.h>
 
+#include <react/renderer/core/PropsChangeSet.h>
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/core/RawProps.h>
 #include <react/renderer/core/ReactPrimitives.h>
@@ -48,6 +49,12 @@ class Props : public virtual Sealable, public virtual DebugStringConvertible {
    */
   int const revision{0};
 
+  /*
+   * Describes which props might differ from the source props object.
+   * See `PropsChangeSet` for details.
+   */
+  PropsChangeSet changeSet{};
+
 #ifdef ANDROID
   folly::dynamic rawProps = folly::dynamic::object();
 #endif
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PropsChangeSet.h"
+
+#include <atomic>
+
+#include <react/renderer/core/RawProps.h>
+#include <react/renderer/core/RawPropsParser.h>
+
+namespace facebook {
+namespace react {
+
+static_assert(
+    sizeof(PropsChangeSet) <= sizeof(uint64_t) + sizeof(void *),
+    "`PropsChangeSet` is a part of every `Props` object and must stay small.");
+
+PropsChangeSet::Identifier PropsChangeSet::nextIdentifier() noexcept {
+  static auto identifier = std::atomic<Identifier>{0};
+  return identifier.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+PropsChangeSet::PropsChangeSet() noexcept : identifier_(nextIdentifier()) {}
+
+PropsChangeSet::PropsChangeSet(Identifier identifier)
+    : identifier_(identifier),
+      changes_(std::make_unique<Changes const>(Changes{identifier})) {}
+
+PropsChangeSet::PropsChangeSet(
+    PropsChangeSet const &sourceChangeSet,
+    RawProps const &rawProps) noexcept
+    : identifier_(nextIdentifier()) {
+  auto parser = rawProps.parser_;
+  if (rawProps.mode_ == RawProps::Mode::Empty || parser == nullptr ||
+      !parser->ready_) {
+    return;
+  }
+
+  auto changes = Changes{sourceChangeSet.identifier_};
+
+  auto const &keyIndexToValueIndex = rawProps.keyIndexToValueIndex_;
+  if (keyIndexToValueIndex.size() > changes.keys.size()) {
+    // Key indices that do not fit into `RawPropsValueIndex`.
+    return;
+  }
+
+  for (size_t keyIndex = 0; keyIndex < keyIndexToValueIndex.size();
+       keyIndex++) {
+    if (keyIndexToValueIndex[keyIndex] != kRawPropsValueIndexEmpty) {
+      changes.keys.set(keyIndex);
+    }
+  }
+
+  changes.keyNames = parser->keyNames_;
+  changes_ = std::make_unique<Changes const>(std::move(changes));
+}
+
+PropsChangeSet const &PropsChangeSet::empty() noexcept {
+  static auto const emptyChangeSet = [] {
+    return PropsChangeSet{nextIdentifier()};
+  }();
+  return emptyChangeSet;
+}
+
+PropsChangeSet::PropsChangeSet(PropsChangeSet const & /*other*/) noexcept
+    : identifier_(nextIdentifier()) {}
+
+PropsChangeSet &PropsChangeSet::operator=(
+    PropsChangeSet const & /*other*/) noexcept {
+  invalidate();
+  return *this;
+}
+
+PropsChangeSet::~PropsChangeSet() noexcept = default;
+
+bool PropsChangeSet::isRelativeTo(
+    PropsChangeSet const &sourceChangeSet) const noexcept {
+  return isKnown() &&
+      changes_->sourceIdentifier == sourceChangeSet.identifier_;
+}
+
+bool PropsChangeSet::isKnown() const noexcept {
+  return changes_ != nullptr;
+}
+
+void PropsChangeSet::invalidate() noexcept {
+  // Sets which are relative to the mutated props must not match them anymore.
+  identifier_ = nextIdentifier();
+  changes_ = nullptr;
+}
+
+bool PropsChangeSet::contains(RawPropsValueIndex keyIndex) const noexcept {
+  return isKnown() && changes_->keys.test(keyIndex);
+}
+
+bool PropsChangeSet::contains(std::string const &name) const noexcept {
+  if (!isKnown() || !changes_->keyNames) {
+    return false;
+  }
+
+  auto const &keyNames = *changes_->keyNames;
+  for (size_t keyIndex = 0; keyIndex < keyNames.size(); keyIndex++) {
+    if (changes_->keys.test(keyIndex) && keyNames[keyIndex] == name) {
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t PropsChangeSet::size() const noexcept {
+  return isKnown() ? changes_->keys.count() : 0;
+}
+
+std::vector<std::string> PropsChangeSet::getNames() const {
+  auto names = std::vector<std::string>{};
+  if (!isKnown() || !changes_->keyNames) {
+    return names;
+  }
+
+  auto const &keyNames = *changes_->keyNames;
+  names.reserve(size());
+  for (size_t keyIndex = 0; keyIndex < keyNames.size(); keyIndex++) {
+    if (changes_->keys.test(keyIndex)) {
+      names.push_back(keyNames[keyIndex]);
+    }
+  }
+  return names;
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <react/renderer/core/RawPropsPrimitives.h>
+
+namespace facebook {
+namespace react {
+
+class RawProps;
+
+/*
+ * Describes which props of a `Props` object might differ from the `Props`
+ * object it was cloned from.
+ *
+ * When `ConcreteComponentDescriptor::cloneProps` parses `RawProps`, it knows
+ * which keys were specified; all other fields are copied from the source
+ * props. The set records those keys (as indices of keys of the `RawPropsParser`
+ * of the particular `Props` type, so it costs a fixed-size bitmask) together
+ * with the identity of the source props, so a consumer that holds the source
+ * props (e.g. the mounting layer holding the mounted props) can apply only the
+ * props that might have changed.
+ * Every `Props` object embeds a set, so only its identity is stored inline; the
+ * recorded keys are stored out of line, and only if the set is known.
+ *
+ * The set is *unknown* (`isKnown()` returns `false`) for default props, for
+ * copies of props objects, for props cloned from empty `RawProps` (which is
+ * only done to mutate the clone afterwards), and for props which were mutated
+ * after construction (see `invalidate`); all props have to be compared then.
+ */
+class PropsChangeSet final {
+ public:
+  using KeyNames = std::vector<std::string>;
+
+  /*
+   * Creates an unknown set.
+   */
+  PropsChangeSet() noexcept;
+
+  /*
+   * Creates a set describing props constructed from `sourceChangeSet`'s props
+   * and `rawProps` (which must be parsed already).
+   */
+  PropsChangeSet(
+      PropsChangeSet const &sourceChangeSet,
+      RawProps const &rawProps) noexcept;
+
+  /*
+   * Returns a known set which contains no props. It describes the difference
+   * between a props object and itself, so it is not relative to any props.
+   */
+  static PropsChangeSet const &empty() noexcept;
+
+  /*
+   * A copy describes a different `Props` object, so it is unknown.
+   */
+  PropsChangeSet(PropsChangeSet const &other) noexcept;
+  PropsChangeSet &operator=(PropsChangeSet const &other) noexcept;
+
+  ~PropsChangeSet() noexcept;
+
+  /*
+   * Returns `true` if the set describes the difference between the props it
+   * belongs to and the props `sourceChangeSet` belongs to.
+   */
+  bool isRelativeTo(PropsChangeSet const &sourceChangeSet) const noexcept;
+
+  /*
+   * Returns `false` if it is unknown which props were changed.
+   */
+  bool isKnown() const noexcept;
+
+  /*
+   * Makes the set unknown and changes the identity of the props object, so
+   * sets of props cloned from it before are not relative to it anymore.
+   * Must be called by code that mutates props objects after construction.
+   */
+  void invalidate() noexcept;
+
+  /*
+   * Returns `true` if a prop with the given key index (or name) might have
+   * changed.
+   */
+  bool contains(RawPropsValueIndex keyIndex) const noexcept;
+  bool contains(std::string const &name) const noexcept;
+
+  /*
+   * Returns the number of props that might have changed.
+   */
+  size_t size() const noexcept;
+
+  /*
+   * Returns names of props that might have changed.
+   */
+  std::vector<std::string> getNames() const;
+
+ private:
+  using Identifier = uint64_t;
+
+  /*
+   * The part of a known set which is stored out of line.
+   */
+  struct Changes final {
+    /*
+     * Identifies the source `Props` object.
+     */
+    Identifier sourceIdentifier;
+
+    std::bitset<size_t{kRawPropsValueIndexEmpty} + 1> keys{};
+
+    /*
+     * Names of all keys of the parser (shared among all parsers of a `Props`
+     * type).
+     */
+    std::shared_ptr<KeyNames const> keyNames{};
+  };
+
+  static Identifier nextIdentifier() noexcept;
+
+  /*
+   * Creates a known empty set (see `empty`).
+   */
+  explicit PropsChangeSet(Identifier identifier);
+
+  /*
+   * Identifies the `Props` object the set belongs to.
+   */
+  Identifier identifier_;
+
+  /*
+   * `nullptr` means unknown.
+   */
+  std::unique_ptr<Changes const> changes_{};
+};
+
+} // namespace react
+} // namespace facebook
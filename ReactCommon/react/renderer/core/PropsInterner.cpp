@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PropsInterner.h"
+
+#include <folly/Hash.h>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+static size_t hashNumber(double number) {
+  // `0.0` and `-0.0` are equal but have different representations.
+  return std::hash<double>{}(number == 0 ? 0.0 : number);
+}
+
+void PropsInterner::setEnabled(bool enabled) const {
+  isEnabled_ = enabled;
+}
+
+bool PropsInterner::isEnabled() const {
+  return isEnabled_;
+}
+
+#pragma mark - Tokens
+
+bool PropsInterner::Token::operator==(Token const &rhs) const {
+  return type == rhs.type && number == rhs.number && string == rhs.string;
+}
+
+bool PropsInterner::Token::operator!=(Token const &rhs) const {
+  return !(*this == rhs);
+}
+
+bool PropsInterner::appendTokens(
+    folly::dynamic const &value,
+    int depth,
+    Tokens &tokens) {
+  if (tokens.size() >= kMaxNumberOfTokens) {
+    return false;
+  }
+
+  switch (value.type()) {
+    case folly::dynamic::NULLT:
+      tokens.push_back(Token{Token::Type::Null, 0, {}});
+      return true;
+    case folly::dynamic::BOOL:
+      tokens.push_back(Token{Token::Type::Bool, value.getBool() ? 1.0 : 0, {}});
+      return true;
+    case folly::dynamic::INT64:
+    case folly::dynamic::DOUBLE:
+      tokens.push_back(Token{Token::Type::Number, value.asDouble(), {}});
+      return true;
+    case folly::dynamic::STRING:
+      tokens.push_back(Token{Token::Type::String, 0, value.getString()});
+      return true;
+    case folly::dynamic::ARRAY:
+      if (depth == kMaxDepth) {
+        return false;
+      }
+      tokens.push_back(
+          Token{Token::Type::Array, static_cast<double>(value.size()), {}});
+      for (auto const &item : value) {
+        if (!appendTokens(item, depth + 1, tokens)) {
+          return false;
+        }
+      }
+      return true;
+    case folly::dynamic::OBJECT: {
+      if (depth == kMaxDepth) {
+        return false;
+      }
+      // Items are ordered by name, so objects with the same items get the
+      // same tokens regardless of the order of the items.
+      auto items = std::vector<
+          std::pair<std::string const *, folly::dynamic const *>>{};
+      items.reserve(value.size());
+      for (auto const &item : value.items()) {
+        if (!item.first.isString()) {
+          return false;
+        }
+        items.emplace_back(&item.first.getString(), &item.second);
+      }
+      std::sort(items.begin(), items.end(), [](auto const &a, auto const &b) {
+        return *a.first < *b.first;
+      });
+      tokens.push_back(
+          Token{Token::Type::Object, static_cast<double>(items.size()), {}});
+      for (auto const &item : items) {
+        tokens.push_back(Token{Token::Type::String, 0, *item.first});
+        if (!appendTokens(*item.second, depth + 1, tokens)) {
+          return false;
+        }
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+bool PropsInterner::appendTokens(
+    jsi::Runtime &runtime,
+    jsi::Value const &value,
+    int depth,
+    Tokens &tokens) {
+  if (tokens.size() >= kMaxNumberOfTokens) {
+    return false;
+  }
+
+  // `null` and `undefined` are the same for props parsing (and for
+  // `jsi::dynamicFromValue`).
+  if (value.isUndefined() || value.isNull()) {
+    tokens.push_back(Token{Token::Type::Null, 0, {}});
+    return true;
+  }
+  if (value.isBool()) {
+    tokens.push_back(Token{Token::Type::Bool, value.getBool() ? 1.0 : 0, {}});
+    return true;
+  }
+  if (value.isNumber()) {
+    tokens.push_back(Token{Token::Type::Number, value.getNumber(), {}});
+    return true;
+  }
+  if (value.isString()) {
+    tokens.push_back(
+        Token{Token::Type::String, 0, value.getString(runtime).utf8(runtime)});
+    return true;
+  }
+  if (!value.isObject()) {
+    return false;
+  }
+
+  auto object = value.getObject(runtime);
+  if (object.isFunction(runtime)) {
+    // Same as `jsi::dynamicFromValue` does for values of objects.
+    tokens.push_back(Token{Token::Type::Null, 0, {}});
+    return true;
+  }
+  if (depth == kMaxDepth) {
+    return false;
+  }
+
+  if (object.isArray(runtime)) {
+    auto array = object.getArray(runtime);
+    auto size = array.size(runtime);
+    if (tokens.size() + size >= kMaxNumberOfTokens) {
+      return false;
+    }
+    tokens.push_back(Token{Token::Type::Array, static_cast<double>(size), {}});
+    for (size_t i = 0; i < size; i++) {
+      auto item = array.getValueAtIndex(runtime, i);
+      if (!appendTokens(runtime, item, depth + 1, tokens)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  auto names = object.getPropertyNames(runtime);
+  auto count = names.size(runtime);
+  if (tokens.size() + count * 2 >= kMaxNumberOfTokens) {
+    return false;
+  }
+
+  // See the `folly::dynamic` overload.
+  auto items = std::vector<std::pair<std::string, jsi::Value>>{};
+  items.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    auto name = names.getValueAtIndex(runtime, i).getString(runtime);
+    auto item = object.getProperty(runtime, name);
+    if (item.isUndefined()) {
+      continue;
+    }
+    items.emplace_back(name.utf8(runtime), std::move(item));
+  }
+  std::sort(items.begin(), items.end(), [](auto const &a, auto const &b) {
+    return a.first < b.first;
+  });
+
+  tokens.push_back(
+      Token{Token::Type::Object, static_cast<double>(items.size()), {}});
+  for (auto &item : items) {
+    tokens.push_back(Token{Token::Type::String, 0, std::move(item.first)});
+    if (!appendTokens(runtime, item.second, depth + 1, tokens)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool PropsInterner::tokensFromRawProps(
+    RawProps const &rawProps,
+    Tokens &tokens) {
+  auto const &keyIndexToValueIndex = rawProps.keyIndexToValueIndex_;
+  for (size_t keyIndex = 0; keyIndex < keyIndexToValueIndex.size();
+       keyIndex++) {
+    auto valueIndex = keyIndexToValueIndex[keyIndex];
+    if (valueIndex == kRawPropsValueIndexEmpty) {
+      continue;
+    }
+
+    tokens.push_back(
+        Token{Token::Type::Key, static_cast<double>(keyIndex), {}});
+    auto const &value = rawProps.values_[valueIndex];
+    auto isAppended = value.runtime_ != nullptr
+        ? appendTokens(*value.runtime_, value.value_, 0, tokens)
+        : appendTokens(value.dynamic_, 0, tokens);
+    if (!isAppended) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t PropsInterner::hashTokens(Tokens const &tokens) {
+  auto result = size_t{0};
+  for (auto const &token : tokens) {
+    result = folly::hash::hash_combine(
+        result,
+        static_cast<uint8_t>(token.type),
+        hashNumber(token.number),
+        token.string);
+  }
+  return result;
+}
+
+#pragma mark - Interning
+
+Props::Shared PropsInterner::intern(
+    PropsParserContext const &context,
+    Props::Shared const &sourceProps,
+    RawProps const &rawProps,
+    Factory const &factory) const {
+  auto tokens = Tokens{};
+  if (!isEnabled_ || rawProps.isEmpty() ||
+      !tokensFromRawProps(rawProps, tokens)) {
+    return factory();
+  }
+
+  auto hash = hashTokens(tokens);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto range = entries_.equal_range(hash);
+    for (auto it = range.first; it != range.second; it++) {
+      auto const &entry = it->second;
+      if (entry.surfaceId != context.surfaceId ||
+          entry.hasSourceProps != (sourceProps != nullptr) ||
+          (sourceProps && entry.sourceProps.lock() != sourceProps)) {
+        continue;
+      }
+
+      auto props = entry.props.lock();
+      if (props && entry.tokens == tokens) {
+        return props;
+      }
+    }
+  }
+
+  auto props = factory();
+  props->seal();
+
+  auto entry = Entry{
+      context.surfaceId,
+      sourceProps != nullptr,
+      sourceProps,
+      std::move(tokens),
+      props};
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.emplace(hash, std::move(entry));
+  if (entries_.size() >= pruneThreshold_) {
+    prune();
+  }
+
+  return props;
+}
+
+void PropsInterner::prune() const {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    auto const &entry = it->second;
+    if (entry.props.expired() ||
+        (entry.hasSourceProps && entry.sourceProps.expired())) {
+      it = entries_.erase(it);
+    } else {
+      it++;
+    }
+  }
+  pruneThreshold_ = std::max(entries_.size() * 2, size_t{64});
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <folly/dynamic.h>
+#include <jsi/jsi.h>
+
+#include <react/renderer/core/Props.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/core/RawProps.h>
+#include <react/renderer/core/ReactPrimitives.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Hash-conses `Props` objects of a particular component type: props objects
+ * created from the same source props and the same values of (known) props
+ * resolve to a single shared, sealed instance. In list-heavy screens hundreds
+ * of siblings usually get identical props (e.g. the same style from a
+ * stylesheet), so interning saves memory and makes pointer-equality checks of
+ * props (e.g. in the differ) succeed more often.
+ *
+ * Only the values of props that the parser knows about are taken into account
+ * (other values do not affect the props object); props with large or deeply
+ * nested values are not interned. Entries do not retain props; they are
+ * dropped after all nodes using the props are gone.
+ *
+ * Interned props must never be mutated after construction, so interning must
+ * not be used for props which are cloned to be mutated (e.g. props cloned from
+ * empty `RawProps`) or on platforms that update `Props::rawProps` in place.
+ * Disabled by default; thread-safe.
+ */
+class PropsInterner final {
+ public:
+  using Factory = std::function<Props::Shared()>;
+
+  /*
+   * Enables or disables interning. If disabled, `intern` just calls
+   * `factory`.
+   */
+  void setEnabled(bool enabled) const;
+  bool isEnabled() const;
+
+  /*
+   * Returns props previously created from the same `sourceProps` and the same
+   * values of `rawProps` or calls `factory` (which must create props from
+   * `sourceProps` and `rawProps`) and remembers the result.
+   * `rawProps` must be parsed already.
+   */
+  Props::Shared intern(
+      PropsParserContext const &context,
+      Props::Shared const &sourceProps,
+      RawProps const &rawProps,
+      Factory const &factory) const;
+
+ private:
+  /*
+   * A flattened value of a known prop: a `Key` token (the key index of the
+   * prop) followed by the tokens of the value; containers are followed by the
+   * tokens of their items (object items are ordered by name, each name is a
+   * `String` token preceding the value of the item).
+   */
+  struct Token {
+    enum class Type : uint8_t {
+      Key,
+      Null,
+      Bool,
+      Number,
+      String,
+      Array,
+      Object,
+    };
+
+    Type type;
+    // The value of `Bool` and `Number`, the size of `Array` and `Object`, the
+    // key index of `Key`.
+    double number;
+    std::string string;
+
+    bool operator==(Token const &rhs) const;
+    bool operator!=(Token const &rhs) const;
+  };
+
+  using Tokens = std::vector<Token>;
+
+  struct Entry {
+    SurfaceId surfaceId;
+    bool hasSourceProps;
+    std::weak_ptr<Props const> sourceProps;
+    Tokens tokens;
+    std::weak_ptr<Props const> props;
+  };
+
+  /*
+   * Only small and shallow props are interned (at most `kMaxNumberOfTokens`
+   * tokens, containers nested at most `kMaxDepth` levels deep): comparing and
+   * storing large values (e.g. long lists of items) costs more than interning
+   * saves.
+   */
+  static constexpr size_t kMaxNumberOfTokens = 128;
+  static constexpr int kMaxDepth = 2;
+
+  /*
+   * Flattens the values of the known props of `rawProps` into `tokens`
+   * (reading every value once). Returns `false` if the values are too large
+   * or too deep to be interned.
+   */
+  static bool tokensFromRawProps(RawProps const &rawProps, Tokens &tokens);
+  static bool appendTokens(
+      folly::dynamic const &value,
+      int depth,
+      Tokens &tokens);
+  static bool appendTokens(
+      jsi::Runtime &runtime,
+      jsi::Value const &value,
+      int depth,
+      Tokens &tokens);
+
+  static size_t hashTokens(Tokens const &tokens);
+
+  /*
+   * Removes entries whose props (or source props) are gone.
+   */
+  void prune() const;
+
+  mutable std::atomic<bool> isEnabled_{false};
+
+  mutable std::mutex mutex_;
+  mutable std::unordered_multimap<size_t, Entry>
+      entries_; // Protected by `mutex_`.
+  mutable size_t pruneThreshold_{64}; // Protected by `mutex_`.
+};
+
+} // namespace react
+} // namespace facebook
@@ -7,8 +7,10 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <react/renderer/core/EventTarget.h>
 #include <react/renderer/core/ValueFactory.h>
@@ -58,6 +60,13 @@ struct RawEvent {
     Continuous = 4
   };
 
+  /*
+   * Produces the payload of the event delivered to the target with the given
+   * index in `batchedEventTargets`.
+   */
+  using BatchedValueFactory =
+      std::function<jsi::Value(jsi::Runtime &runtime, size_t index)>;
+
   RawEvent(
       std::string type,
       ValueFactory payloadFactory,
@@ -68,6 +77,16 @@ struct RawEvent {
   ValueFactory payloadFactory;
   SharedEventTarget eventTarget;
   Category category;
+
+  /*
+   * If not empty, the event is a batch of events of the same `type` and
+   * `category`: instead of `eventTarget` (and `payloadFactory`), the event is
+   * delivered to all of the listed targets in order, with payloads produced
+   * by `batchedPayloadFactory`. A batch takes a single slot in the event queue
+   * and is delivered in one go.
+   */
+  std::vector<SharedEventTarget> batchedEventTargets{};
+  BatchedValueFactory batchedPayloadFactory{};
 };
 
 } // namespace react
@@ -99,6 +99,8 @@ class RawProps final {
 
  private:
   friend class RawPropsParser;
+  friend class PropsChangeSet;
+  friend class PropsInterner;
 
   mutable RawPropsParser const *parser_{nullptr};
 
@@ -13,10 +13,18 @@
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <vector>
 
 namespace facebook {
 namespace react {
 
+/*
+ * The number of props of any component is much lower than this; the limit
+ * only guarantees termination in (practically impossible) case of colliding
+ * hashes.
+ */
+static constexpr size_t kMaximumNumberOfSlots = 1 << 16;
+
 bool RawPropsKeyMap::hasSameName(Item const &lhs, Item const &rhs) noexcept {
   return lhs.length == rhs.length &&
       (std::memcmp(lhs.name, rhs.name, lhs.length) == 0);
@@ -60,48 +68,141 @@ void RawPropsKeyMap::reindex() noexcept {
       std::unique(items_.begin(), items_.end(), &RawPropsKeyMap::hasSameName),
       items_.end());
 
-  buckets_.resize(kPropNameLengthHardCap);
+  react_native_assert(items_.size() < kRawPropsValueIndexEmpty);
+
+  // Two items per bucket on average and at least two slots per item make
+  // finding seeds for all buckets quick; the table is enlarged otherwise.
+  auto numberOfBuckets = std::max(items_.size() / 2, size_t{1});
+  auto numberOfSlots = size_t{8};
+  while (numberOfSlots < items_.size() * 2) {
+    numberOfSlots *= 2;
+  }
+
+  seeds_.resize(numberOfBuckets);
+  auto isBuilt = false;
+  while (!isBuilt && numberOfSlots <= kMaximumNumberOfSlots) {
+    isBuilt = buildPerfectHash(numberOfSlots);
+    numberOfSlots *= 2;
+  }
+  react_native_assert(
+      isBuilt && "Failed to build a perfect hash function for prop names.");
+}
+
+uint64_t RawPropsKeyMap::hash(
+    char const *name,
+    RawPropsPropNameLength length) noexcept {
+  // FNV-1a.
+  auto result = uint64_t{14695981039346656037ull};
+  for (auto i = 0; i < length; i++) {
+    result ^= static_cast<uint8_t>(name[i]);
+    result *= uint64_t{1099511628211ull};
+  }
+  return result;
+}
+
+size_t RawPropsKeyMap::slotIndex(
+    uint64_t hash,
+    uint16_t seed,
+    size_t mask) noexcept {
+  // The finalizer of MurmurHash3 applied to the seeded hash.
+  auto result = hash ^ (seed * uint64_t{0x9e3779b97f4a7c15ull});
+  result ^= result >> 33;
+  result *= uint64_t{0xff51afd7ed558ccdull};
+  result ^= result >> 33;
+  result *= uint64_t{0xc4ceb9fe1a85ec53ull};
+  result ^= result >> 33;
+  return static_cast<size_t>(result) & mask;
+}
+
+bool RawPropsKeyMap::buildPerfectHash(size_t numberOfSlots) noexcept {
+  auto numberOfBuckets = seeds_.size();
+  auto mask = numberOfSlots - 1;
 
-  auto length = RawPropsPropNameLength{0};
+  auto hashes = std::vector<uint64_t>{};
+  auto buckets = std::vector<std::vector<RawPropsValueIndex>>(numberOfBuckets);
+  hashes.reserve(items_.size());
   for (size_t i = 0; i < items_.size(); i++) {
-    auto &item = items_[i];
-    if (item.length != length) {
-      for (auto j = length; j < item.length; j++) {
-        buckets_[j] = static_cast<RawPropsPropNameLength>(i);
+    auto itemHash = hash(items_[i].name, items_[i].length);
+    hashes.push_back(itemHash);
+    buckets[(itemHash >> 32) % numberOfBuckets].push_back(
+        static_cast<RawPropsValueIndex>(i));
+  }
+
+  // The biggest buckets are the hardest to place, so they go first.
+  auto order = std::vector<size_t>(numberOfBuckets);
+  for (size_t i = 0; i < numberOfBuckets; i++) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+    return buckets[lhs].size() > buckets[rhs].size();
+  });
+
+  slots_.assign(numberOfSlots, kRawPropsValueIndexEmpty);
+  auto placedSlots = std::vector<size_t>{};
+
+  for (auto bucketIndex : order) {
+    auto const &bucket = buckets[bucketIndex];
+    seeds_[bucketIndex] = 0;
+    if (bucket.empty()) {
+      continue;
+    }
+
+    auto isPlaced = false;
+    for (uint32_t seed = 0; seed <= UINT16_MAX && !isPlaced; seed++) {
+      placedSlots.clear();
+      isPlaced = true;
+      for (auto itemIndex : bucket) {
+        auto slot =
+            slotIndex(hashes[itemIndex], static_cast<uint16_t>(seed), mask);
+        if (slots_[slot] != kRawPropsValueIndexEmpty) {
+          isPlaced = false;
+          break;
+        }
+        slots_[slot] = itemIndex;
+        placedSlots.push_back(slot);
+      }
+
+      if (isPlaced) {
+        seeds_[bucketIndex] = static_cast<uint16_t>(seed);
+      } else {
+        for (auto slot : placedSlots) {
+          slots_[slot] = kRawPropsValueIndexEmpty;
+        }
       }
-      length = item.length;
     }
-  }
 
-  for (auto j = length; j < buckets_.size(); j++) {
-    buckets_[j] = static_cast<RawPropsPropNameLength>(items_.size());
+    if (!isPlaced) {
+      return false;
+    }
   }
+
+  return true;
 }
 
 RawPropsValueIndex RawPropsKeyMap::at(
     char const *name,
-    RawPropsPropNameLength length) noexcept {
+    RawPropsPropNameLength length) const noexcept {
   react_native_assert(length > 0);
   react_native_assert(length < kPropNameLengthHardCap);
-  // 1. Find the bucket.
-  auto lower = int{buckets_[length - 1]};
-  auto upper = int{buckets_[length]} - 1;
-  react_native_assert(lower - 1 <= upper);
-
-  // 2. Binary search in the bucket.
-  while (lower <= upper) {
-    auto median = (lower + upper) / 2;
-    auto condition = std::memcmp(items_[median].name, name, length);
-    if (condition < 0) {
-      lower = median + 1;
-    } else if (condition == 0) {
-      return items_[median].value;
-    } else /* if (condition > 0) */ {
-      upper = median - 1;
-    }
+  if (slots_.empty()) {
+    return kRawPropsValueIndexEmpty;
+  }
+
+  // 1. Find the only candidate.
+  auto nameHash = hash(name, length);
+  auto seed = seeds_[(nameHash >> 32) % seeds_.size()];
+  auto itemIndex = slots_[slotIndex(nameHash, seed, slots_.size() - 1)];
+  if (itemIndex == kRawPropsValueIndexEmpty) {
+    return kRawPropsValueIndexEmpty;
+  }
+
+  // 2. Compare the names.
+  auto const &item = items_[itemIndex];
+  if (item.length != length || std::memcmp(item.name, name, length) != 0) {
+    return kRawPropsValueIndexEmpty;
   }
 
-  return kRawPropsValueIndexEmpty;
+  return item.value;
 }
 
 } // namespace react
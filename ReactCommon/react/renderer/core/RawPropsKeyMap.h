@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 #include <butter/small_vector.h>
 
 #include <react/renderer/core/RawPropsKey.h>
@@ -17,8 +20,12 @@ namespace react {
 
 /*
  * A map especially optimized to hold `{name: index}` relations.
- * The implementation is conceptually similar to a classic hash map with a hash
- * function that returns the length of the string.
+ * The map is built once (the set of keys of some `*Props` class is fixed) and
+ * then used for a lot of reads, so `reindex` constructs a perfect hash
+ * function (hash-and-displace) over the stored keys: a lookup costs one hash of
+ * the name and a single comparison with the only candidate key.
+ * The function is not minimal: the table has at least twice as many slots as
+ * keys (a power of two), which keeps building it fast.
  * The map is optimized for reads only (the map must be reindexed before a bunch
  * of reads).
  */
@@ -41,7 +48,7 @@ class RawPropsKeyMap final {
    */
   RawPropsValueIndex at(
       char const *name,
-      RawPropsPropNameLength length) noexcept;
+      RawPropsPropNameLength length) const noexcept;
 
  private:
   struct Item {
@@ -55,9 +62,30 @@ class RawPropsKeyMap final {
       Item const &rhs) noexcept;
   static bool hasSameName(Item const &lhs, Item const &rhs) noexcept;
 
+  static uint64_t hash(
+      char const *name,
+      RawPropsPropNameLength length) noexcept;
+  static size_t slotIndex(uint64_t hash, uint16_t seed, size_t mask) noexcept;
+
+  /*
+   * Tries to find a seed for every bucket so that all items end up in
+   * different slots of a table of the given size (a power of two).
+   */
+  bool buildPerfectHash(size_t numberOfSlots) noexcept;
+
   butter::small_vector<Item, kNumberOfExplicitlySpecifedPropsSoftCap> items_{};
-  butter::small_vector<RawPropsPropNameLength, kPropNameLengthHardCap>
-      buckets_{};
+
+  /*
+   * Seeds of buckets (items are distributed among buckets by their hashes);
+   * the seed of a bucket chooses the slots of its items.
+   */
+  butter::small_vector<uint16_t, kNumberOfPropsPerComponentSoftCap> seeds_{};
+
+  /*
+   * Indices of `items_` (or `kRawPropsValueIndexEmpty`), a power of two long.
+   */
+  butter::small_vector<RawPropsValueIndex, kNumberOfPropsPerComponentSoftCap>
+      slots_{};
 };
 
 } // namespace react
@@ -90,6 +90,13 @@ RawValue const *RawPropsParser::at(
 void RawPropsParser::postPrepare() noexcept {
   ready_ = true;
   nameToIndex_.reindex();
+
+  auto keyNames = std::make_shared<PropsChangeSet::KeyNames>();
+  keyNames->reserve(keys_.size());
+  for (auto const &key : keys_) {
+    keyNames->push_back((std::string)key);
+  }
+  keyNames_ = std::move(keyNames);
 }
 
 void RawPropsParser::preparse(RawProps const &rawProps) const noexcept {
@@ -117,8 +124,6 @@ void RawPropsParser::preparse(RawProps const &rawProps) const noexcept {
 
       for (size_t i = 0; i < count; i++) {
         auto nameValue = names.getValueAtIndex(runtime, i).getString(runtime);
-        auto value = object.getProperty(runtime, nameValue);
-
         auto name = nameValue.utf8(runtime);
 
         auto keyIndex = nameToIndex_.at(
@@ -127,9 +132,12 @@ void RawPropsParser::preparse(RawProps const &rawProps) const noexcept {
           continue;
         }
 
+        // Values of unknown props are never read; values of known props are
+        // stored as they are and converted lazily by `RawValue`, so nested
+        // objects (e.g. `style` or `transform`) are not copied up front.
         rawProps.keyIndexToValueIndex_[keyIndex] = valueIndex;
         rawProps.values_.push_back(
-            RawValue(jsi::dynamicFromValue(runtime, value)));
+            RawValue(runtime, object.getProperty(runtime, nameValue)));
         valueIndex++;
       }
 
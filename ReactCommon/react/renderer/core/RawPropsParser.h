@@ -10,6 +10,7 @@
 #include <butter/map.h>
 #include <butter/small_vector.h>
 #include <react/renderer/core/Props.h>
+#include <react/renderer/core/PropsChangeSet.h>
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/core/RawProps.h>
 #include <react/renderer/core/RawPropsKey.h>
@@ -40,6 +41,29 @@ class RawPropsParser final {
     static_assert(
         std::is_base_of<Props, PropsT>::value,
         "PropsT must be a descendant of Props");
+    // The set of keys (and the hash table built from it) depends only on
+    // `PropsT`, so the keys are discovered once per process (by the first
+    // `ComponentDescriptor` of the type) and simply copied afterwards.
+    static auto const preparedParser = [] {
+      auto parser = RawPropsParser{};
+      parser.discoverKeys<PropsT>();
+      return parser;
+    }();
+    *this = preparedParser;
+  }
+
+ private:
+  friend class ComponentDescriptor;
+  template <class ShadowNodeT>
+  friend class ConcreteComponentDescriptor;
+  friend class RawProps;
+  friend class PropsChangeSet;
+
+  /*
+   * Collects all keys that `PropsT` accesses by parsing empty raw props.
+   */
+  template <typename PropsT>
+  void discoverKeys() noexcept {
     RawProps emptyRawProps{};
 
     // Create a stub parser context.
@@ -54,12 +78,6 @@ class RawPropsParser final {
     postPrepare();
   }
 
- private:
-  friend class ComponentDescriptor;
-  template <class ShadowNodeT>
-  friend class ConcreteComponentDescriptor;
-  friend class RawProps;
-
   /*
    * To be used by `RawProps` only.
    */
@@ -80,6 +98,11 @@ class RawPropsParser final {
       keys_{};
   mutable RawPropsKeyMap nameToIndex_{};
   mutable bool ready_{false};
+
+  /*
+   * Names of `keys_` (by key index); shared with `PropsChangeSet`s.
+   */
+  std::shared_ptr<PropsChangeSet::KeyNames const> keyNames_{};
 };
 
 } // namespace react
@@ -26,10 +26,13 @@ class RawPropsParser;
  *
  * The main intention of the class is to abstract React props parsing infra from
  * JSI, to enable support for any non-JSI-based data sources. The particular
- * implementation of the interface is a very slim abstraction around
- * `folly::dynamic` though.
- * In the near future, this class will hold a `jsi::Runtime` and `jsi::Value`
- * pair instead of `folly::dynamic`.
+ * implementation of the interface holds either a `jsi::Runtime` and
+ * `jsi::Value` pair (when props come from JavaScript) or `folly::dynamic`.
+ * A JSI-backed value is read lazily: scalars are converted directly from the
+ * `jsi::Value`, and nested objects and arrays are only visited when some
+ * prop-parsing code actually casts them (elements of casted containers are
+ * JSI-backed as well). A JSI-backed value can only be accessed on the
+ * JavaScript thread, while the `jsi::Runtime` is alive.
  *
  * How `RawValue` is different from `JSI::Value`:
  *  * `RawValue` provides much more scoped API without any references to
@@ -54,11 +57,16 @@ class RawValue {
    */
   RawValue() noexcept : dynamic_(nullptr){};
 
-  RawValue(RawValue &&other) noexcept : dynamic_(std::move(other.dynamic_)) {}
+  RawValue(RawValue &&other) noexcept
+      : dynamic_(std::move(other.dynamic_)),
+        runtime_(other.runtime_),
+        value_(std::move(other.value_)) {}
 
   RawValue &operator=(RawValue &&other) noexcept {
     if (this != &other) {
       dynamic_ = std::move(other.dynamic_);
+      runtime_ = other.runtime_;
+      value_ = std::move(other.value_);
     }
     return *this;
   }
@@ -66,6 +74,7 @@ class RawValue {
  private:
   friend class RawProps;
   friend class RawPropsParser;
+  friend class PropsInterner;
   friend class UIManagerBinding;
 
   /*
@@ -75,16 +84,27 @@ class RawValue {
 
   RawValue(folly::dynamic &&dynamic) noexcept : dynamic_(std::move(dynamic)){};
 
+  RawValue(jsi::Runtime &runtime, const jsi::Value &value) noexcept
+      : dynamic_(nullptr), runtime_(&runtime), value_(runtime, value){};
+
+  RawValue(jsi::Runtime &runtime, jsi::Value &&value) noexcept
+      : dynamic_(nullptr), runtime_(&runtime), value_(std::move(value)){};
+
   /*
    * Copy constructor and copy assignment operator would be private and only for
    * internal use, but it's needed for user-code that does `auto val =
    * (butter::map<std::string, RawValue>)rawVal;`
    */
-  RawValue(RawValue const &other) noexcept : dynamic_(other.dynamic_) {}
+  RawValue(RawValue const &other) noexcept
+      : dynamic_(other.dynamic_),
+        runtime_(other.runtime_),
+        value_(copyValue(other.runtime_, other.value_)) {}
 
   RawValue &operator=(const RawValue &other) noexcept {
     if (this != &other) {
       dynamic_ = other.dynamic_;
+      runtime_ = other.runtime_;
+      value_ = copyValue(other.runtime_, other.value_);
     }
     return *this;
   }
@@ -95,10 +115,16 @@ class RawValue {
    */
   template <typename T>
   explicit operator T() const noexcept {
+    if (runtime_ != nullptr) {
+      return castValue(*runtime_, value_, (T *)nullptr);
+    }
     return castValue(dynamic_, (T *)nullptr);
   }
 
   inline explicit operator folly::dynamic() const noexcept {
+    if (runtime_ != nullptr) {
+      return dynamicFromValue(*runtime_, value_);
+    }
     return dynamic_;
   }
 
@@ -107,6 +133,9 @@ class RawValue {
    */
   template <typename T>
   bool hasType() const noexcept {
+    if (runtime_ != nullptr) {
+      return checkValueType(*runtime_, value_, (T *)nullptr);
+    }
     return checkValueType(dynamic_, (T *)nullptr);
   };
 
@@ -114,12 +143,76 @@ class RawValue {
    * Checks if the stored value is *not* `null`.
    */
   bool hasValue() const noexcept {
+    if (runtime_ != nullptr) {
+      return !value_.isNull() && !value_.isUndefined();
+    }
     return !dynamic_.isNull();
   }
 
  private:
   folly::dynamic dynamic_;
 
+  /*
+   * Set only if the value is backed by a `jsi::Value`.
+   */
+  jsi::Runtime *runtime_{nullptr};
+  jsi::Value value_;
+
+  static jsi::Value copyValue(
+      jsi::Runtime *runtime,
+      const jsi::Value &value) noexcept {
+    return runtime != nullptr ? jsi::Value(*runtime, value) : jsi::Value();
+  }
+
+  static folly::dynamic dynamicFromValue(
+      jsi::Runtime &runtime,
+      const jsi::Value &value) noexcept {
+    // Same as `RawPropsParser` used to do for top-level values, except that
+    // functions (which are not convertible) become `null`.
+    if (isFunction(runtime, value)) {
+      return nullptr;
+    }
+    return jsi::dynamicFromValue(runtime, value);
+  }
+
+  static bool isFunction(
+      jsi::Runtime &runtime,
+      const jsi::Value &value) noexcept {
+    return value.isObject() && value.getObject(runtime).isFunction(runtime);
+  }
+
+  static bool isArray(jsi::Runtime &runtime, const jsi::Value &value) noexcept {
+    return value.isObject() && value.getObject(runtime).isArray(runtime);
+  }
+
+  /*
+   * Iterates over the properties of a JavaScript object the same way
+   * `jsi::dynamicFromValue` does: `undefined` values are skipped and
+   * functions are substituted with `null`.
+   * The callback returns `false` to stop the iteration.
+   */
+  template <typename CallbackT>
+  static void forEachProperty(
+      jsi::Runtime &runtime,
+      const jsi::Object &object,
+      CallbackT &&callback) noexcept {
+    auto names = object.getPropertyNames(runtime);
+    auto size = names.size(runtime);
+    for (size_t i = 0; i < size; i++) {
+      auto name = names.getValueAtIndex(runtime, i).getString(runtime);
+      auto value = object.getProperty(runtime, name);
+      if (value.isUndefined()) {
+        continue;
+      }
+      if (isFunction(runtime, value)) {
+        value = jsi::Value::null();
+      }
+      if (!callback(name, value)) {
+        return;
+      }
+    }
+  }
+
   static bool checkValueType(
       const folly::dynamic &dynamic,
       RawValue *type) noexcept {
@@ -278,6 +371,184 @@ class RawValue {
     }
     return result;
   }
+  // Type checks for JSI-backed values
+  static bool checkValueType(
+      jsi::Runtime &runtime,
+      const jsi::Value &value,
+      RawValue *type) noexcept {
+    return true;
+  }
+
+  static bool checkValueType(
+      jsi::Runtime &runtime,
+      const jsi::Value &value,
+      bool *type) noexcept {
+    return value.isBool();
+  }
+
+  static bool checkValueType(
+      jsi::Runtime &runtime,
+      const jsi::Value &value,
+      int *type) noexcept {
+    return value.isNumber();
+  }
+
+  static bool checkValueType(
+      jsi::Runtime &runtime,
+      const jsi::Value &value,
+      int64_t *type) noexcept {
+    return value.isNumber();
+  }
+
+  static bool checkValueType(
+      jsi::Runtime &runtime,
+      const jsi::Value &value,
+      float *type) noexcept {
+    return value.isNumber();
+  }
+
+  static bool checkValueType(
+      jsi::Runtime &runtime,
+      const jsi::Value &value,
+      double *type) noexcept {
+    return value.isNumber();
+  }
+
+  static bool checkValueType(
+      jsi::Runtime &runtime,
+      const jsi::Value &value,
+      std::string *type) noexcept {
+    return value.isString();
+  }
+
+  template <typename T>
+  static bool checkValueType(
+      jsi::Runtime &runtime,
+      const jsi::Value &value,
+      std::vector<T> *type) noexcept {
+    if (!isArray(runtime, value)) {
+      return false;
+    }
+
+    auto array = value.getObject(runtime).getArray(runtime);
+    if (array.size(runtime) == 0) {
+      return true;
+    }
+
+    // Note: We test only one element.
+    return checkValueType(
+        runtime, array.getValueAtIndex(runtime, 0), (T *)nullptr);
+  }
+
+  template <typename T>
+  static bool checkValueType(
+      jsi::Runtime &runtime,
+      const jsi::Value &value,
+      butter::map<std::string, T> *type) noexcept {
+    if (!value.isObject()) {
+      return false;
+    }
+
+    auto object = value.getObject(runtime);
+    if (object.isArray(runtime) || object.isFunction(runtime)) {
+      return false;
+    }
+
+    auto result = true;
+    forEachProperty(
+        runtime,
+        object,
+        [&](const jsi::String &name, const jsi::Value &item) {
+          // Note: We test only one element.
+          result = checkValueType(runtime, item, (T *)nullptr);
+          return false;
+        });
+    return result;
+  }
+
+  // Casts for JSI-backed values
+  static RawValue castValue(
+      jsi::Runtime &runtime,
+      const jsi::Value &value,
+      RawValue *type) noexcept {
+    return RawValue(runtime, value);
+  }
+
+  static bool castValue(
+      jsi::Runtime &runtime,
+      const jsi::Value &value,
+      bool *type) noexcept {
+    return value.getBool();
+  }
+
+  static int castValue(
+      jsi::Runtime &runtime,
+      const jsi::Value &value,
+      int *type) noexcept {
+    return static_cast<int>(value.getNumber());
+  }
+
+  static int64_t castValue(
+      jsi::Runtime &runtime,
+      const jsi::Value &value,
+      int64_t *type) noexcept {
+    return static_cast<int64_t>(value.getNumber());
+  }
+
+  static float castValue(
+      jsi::Runtime &runtime,
+      const jsi::Value &value,
+      float *type) noexcept {
+    return static_cast<float>(value.getNumber());
+  }
+
+  static double castValue(
+      jsi::Runtime &runtime,
+      const jsi::Value &value,
+      double *type) noexcept {
+    return value.getNumber();
+  }
+
+  static std::string castValue(
+      jsi::Runtime &runtime,
+      const jsi::Value &value,
+      std::string *type) noexcept {
+    return value.getString(runtime).utf8(runtime);
+  }
+
+  template <typename T>
+  static std::vector<T> castValue(
+      jsi::Runtime &runtime,
+      const jsi::Value &value,
+      std::vector<T> *type) noexcept {
+    react_native_assert(isArray(runtime, value));
+    auto array = value.getObject(runtime).getArray(runtime);
+    auto size = array.size(runtime);
+    auto result = std::vector<T>{};
+    result.reserve(size);
+    for (size_t i = 0; i < size; i++) {
+      result.push_back(castValue(
+          runtime, array.getValueAtIndex(runtime, i), (T *)nullptr));
+    }
+    return result;
+  }
+
+  template <typename T>
+  static butter::map<std::string, T> castValue(
+      jsi::Runtime &runtime,
+      const jsi::Value &value,
+      butter::map<std::string, T> *type) noexcept {
+    react_native_assert(value.isObject());
+    auto result = butter::map<std::string, T>{};
+    forEachProperty(
+        runtime,
+        value.getObject(runtime),
+        [&](const jsi::String &name, const jsi::Value &item) {
+          result[name.utf8(runtime)] = castValue(runtime, item, (T *)nullptr);
+          return true;
+        });
+    return result;
+  }
 };
 
 } // namespace react
@@ -22,6 +22,41 @@
 namespace facebook {
 namespace react {
 
+/*
+ * Returns `true` if the nodes have the same traits that can affect the views
+ * and mutations produced for them.
+ */
+static bool areMountRelevantTraitsEqual(
+    ShadowNodeTraits lhs,
+    ShadowNodeTraits rhs) {
+  for (auto trait :
+       {ShadowNodeTraits::Trait::Hidden,
+        ShadowNodeTraits::Trait::View,
+        ShadowNodeTraits::Trait::FormsStackingContext,
+        ShadowNodeTraits::Trait::FormsView}) {
+    if (lhs.check(trait) != rhs.check(trait)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static ShadowNode::MountGeneration nextMountGeneration() {
+  static auto generation = std::atomic<ShadowNode::MountGeneration>{0};
+  return generation.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+static std::shared_ptr<std::vector<ShadowNode::MountGeneration> const>
+mountGenerationsOfChildren(SharedShadowNodeList const &children) {
+  auto generations =
+      std::make_shared<std::vector<ShadowNode::MountGeneration>>();
+  generations->reserve(children.size());
+  for (auto const &child : children) {
+    generations->push_back(child->getMountGeneration());
+  }
+  return generations;
+}
+
 SharedShadowNodeSharedList ShadowNode::emptySharedShadowNodeSharedList() {
   static const auto emptySharedShadowNodeSharedList =
       std::make_shared<SharedShadowNodeList>();
@@ -114,6 +149,27 @@ ShadowNode::ShadowNode(
       child->family_->setParent(family_);
     }
   }
+
+  auto sourceGeneration = sourceShadowNode.getMountGeneration();
+  if (sourceGeneration != 0) {
+    mountGenerationSource_.generation = sourceGeneration;
+    mountGenerationSource_.orderIndex = sourceShadowNode.orderIndex_;
+    mountGenerationSource_.traits = sourceShadowNode.traits_;
+  } else {
+    // The source node was never stamped; comparing with its own source.
+    mountGenerationSource_ = sourceShadowNode.mountGenerationSource_;
+  }
+
+  if (mountGenerationSource_.generation != 0 &&
+      !mountGenerationSource_.childrenGenerations &&
+      children_ != sourceShadowNode.children_) {
+    // Children of the source are the ones of the stamped node.
+    mountGenerationSource_.childrenGenerations =
+        mountGenerationsOfChildren(*sourceShadowNode.children_);
+  }
+
+  mountGenerationSource_.isChanged = mountGenerationSource_.isChanged ||
+      props_ != sourceShadowNode.props_ || state_ != sourceShadowNode.state_;
 }
 
 ShadowNode::Unshared ShadowNode::clone(
@@ -171,6 +227,68 @@ int ShadowNode::getOrderIndex() const {
   return orderIndex_;
 }
 
+void ShadowNode::stampMountGenerationRecursive() const {
+  if (getMountGeneration() != 0) {
+    return;
+  }
+
+  for (auto const &child : *children_) {
+    child->stampMountGenerationRecursive();
+  }
+
+  stampMountGeneration();
+}
+
+void ShadowNode::sealAndStamp() const {
+  if (!getSealed()) {
+    seal();
+    props_->seal();
+  }
+
+  if (getMountGeneration() == 0) {
+    stampMountGeneration();
+  }
+}
+
+void ShadowNode::stampMountGeneration() const {
+  auto const &source = mountGenerationSource_;
+  auto isEquivalent = source.generation != 0 && !source.isChanged &&
+      source.orderIndex == orderIndex_ &&
+      areMountRelevantTraitsEqual(source.traits, traits_);
+
+  if (isEquivalent && source.childrenGenerations) {
+    auto const &childrenGenerations = *source.childrenGenerations;
+    isEquivalent = childrenGenerations.size() == children_->size();
+    for (size_t i = 0; isEquivalent && i < childrenGenerations.size(); i++) {
+      isEquivalent =
+          childrenGenerations[i] == children_->at(i)->getMountGeneration();
+    }
+  }
+
+  auto generation = isEquivalent ? source.generation : nextMountGeneration();
+
+  // The node might be concurrently stamped as part of another commit; the
+  // first stamp wins.
+  auto expected = MountGeneration{0};
+  mountGeneration_.compare_exchange_strong(
+      expected, generation, std::memory_order_relaxed);
+}
+
+ShadowNode::MountGeneration ShadowNode::getMountGeneration() const {
+  return mountGeneration_.load(std::memory_order_relaxed);
+}
+
+bool ShadowNode::areSubtreesMountEquivalent(
+    ShadowNode const &lhs,
+    ShadowNode const &rhs) {
+  if (&lhs == &rhs) {
+    return true;
+  }
+
+  auto generation = lhs.getMountGeneration();
+  return generation != 0 && generation == rhs.getMountGeneration();
+}
+
 void ShadowNode::sealRecursive() const {
   if (getSealed()) {
     return;
@@ -237,9 +355,21 @@ void ShadowNode::cloneChildrenIfShared() {
   }
 
   traits_.unset(ShadowNodeTraits::Trait::ChildrenAreShared);
+
+  if (mountGenerationSource_.generation != 0 &&
+      !mountGenerationSource_.childrenGenerations) {
+    // The list is about to diverge from the one of the stamped source node.
+    mountGenerationSource_.childrenGenerations =
+        mountGenerationsOfChildren(*children_);
+  }
+
   children_ = std::make_shared<SharedShadowNodeList>(*children_);
 }
 
+void ShadowNode::invalidateMountGeneration() {
+  mountGenerationSource_.isChanged = true;
+}
+
 void ShadowNode::setMounted(bool mounted) const {
   if (mounted) {
     family_->setMostRecentState(getState());
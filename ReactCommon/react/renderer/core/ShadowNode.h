@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -57,6 +59,12 @@ class ShadowNode : public Sealable, public DebugStringConvertible {
           int /* childIndex */>,
       64>;
 
+  /*
+   * Identifies the mount-relevant content (see `stampMountGenerationRecursive`)
+   * of a subtree. `0` means that the node has not been stamped yet.
+   */
+  using MountGeneration = uint64_t;
+
   static SharedShadowNodeSharedList emptySharedShadowNodeSharedList();
 
   /*
@@ -161,6 +169,42 @@ class ShadowNode : public Sealable, public DebugStringConvertible {
 
   void sealRecursive() const;
 
+  /*
+   * Assigns a mount generation to the node and all its descendants that do
+   * not have one yet. Must be called on a fully laid out tree (during commit).
+   *
+   * A node that is mount-equivalent to the stamped node it was (directly or
+   * transitively) cloned from, i.e. has the same props, state, mount-relevant
+   * traits, order index and layout metrics, and children of the same
+   * generations, inherits the generation of that node. Any other node gets a
+   * new, unique generation. Therefore, two subtrees with the same
+   * (non-zero) generation produce identical views and mutations.
+   */
+  void stampMountGenerationRecursive() const;
+
+  /*
+   * Seals the node (like `sealRecursive`) and stamps its mount generation
+   * (like `stampMountGenerationRecursive`) without visiting the children;
+   * the children must be stamped already. Meant for traversals that visit
+   * the tree on their own, e.g. the post-commit pass of `ShadowTree`.
+   */
+  void sealAndStamp() const;
+
+  /*
+   * Returns the mount generation of the node, or `0` if the node has not been
+   * stamped.
+   */
+  MountGeneration getMountGeneration() const;
+
+  /*
+   * Returns `true` if the subtrees rooted at the given nodes are known to be
+   * mount-equivalent: the nodes are the same, or they were stamped with the
+   * same mount generation.
+   */
+  static bool areSubtreesMountEquivalent(
+      ShadowNode const &lhs,
+      ShadowNode const &rhs);
+
   ShadowNodeFamily const &getFamily() const;
 
 #pragma mark - Mutating Methods
@@ -209,6 +253,29 @@ class ShadowNode : public Sealable, public DebugStringConvertible {
    */
   void cloneChildrenIfShared();
 
+  /*
+   * Stamps the node assuming that all its children are stamped.
+   */
+  void stampMountGeneration() const;
+
+  /*
+   * Describes the stamped node this node was (directly or transitively)
+   * cloned from. Set up during construction and updated only while the node
+   * is still mutable; see `stampMountGenerationRecursive`.
+   */
+  struct MountGenerationSource {
+    MountGeneration generation{0};
+    bool isChanged{false};
+    int orderIndex{0};
+    ShadowNodeTraits traits{};
+    // Generations of the children of the source node; only set if the list of
+    // children diverged from the one of the source node.
+    std::shared_ptr<std::vector<MountGeneration> const> childrenGenerations{};
+  };
+
+  MountGenerationSource mountGenerationSource_{};
+  mutable std::atomic<MountGeneration> mountGeneration_{0};
+
   /*
    * Pointer to a family object that this shadow node belongs to.
    */
@@ -221,6 +288,13 @@ class ShadowNode : public Sealable, public DebugStringConvertible {
       Props::Shared const &props);
 
  protected:
+  /*
+   * Marks the node as not mount-equivalent to the node it was cloned from.
+   * Must be called by subclasses that change mount-relevant data (e.g. layout
+   * metrics) of an unsealed node outside of the constructor.
+   */
+  void invalidateMountGeneration();
+
   /*
    * Traits associated with the particular `ShadowNode` class and an instance of
    * that class.
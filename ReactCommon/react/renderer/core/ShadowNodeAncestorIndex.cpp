@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ShadowNodeAncestorIndex.h"
+
+#include <butter/small_vector.h>
+
+#include <utility>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Parents with fewer children are scanned linearly; building a map for them
+ * does not pay off.
+ */
+static constexpr size_t kMinimumNumberOfIndexedChildren = 16;
+
+ShadowNodeAncestorIndex::ShadowNodeAncestorIndex(
+    ShadowNode::Shared rootShadowNode)
+    : rootShadowNode_(std::move(rootShadowNode)) {}
+
+ShadowNode::Shared const &ShadowNodeAncestorIndex::getRootShadowNode() const {
+  return rootShadowNode_;
+}
+
+/*
+ * Finds the child of the given family by scanning all children.
+ */
+static int findChildIndex(
+    ShadowNode const &parentShadowNode,
+    ShadowNodeFamily const &childFamily) {
+  auto const &children = parentShadowNode.getChildren();
+  for (size_t index = 0; index < children.size(); index++) {
+    if (&children[index]->getFamily() == &childFamily) {
+      return static_cast<int>(index);
+    }
+  }
+  return -1;
+}
+
+int ShadowNodeAncestorIndex::getChildIndex(
+    ShadowNode const &parentShadowNode,
+    ShadowNodeFamily const &childFamily) const {
+  auto const &children = parentShadowNode.getChildren();
+
+  if (children.size() < kMinimumNumberOfIndexedChildren) {
+    return findChildIndex(parentShadowNode, childFamily);
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  auto &childIndexMap = childIndexMaps_[&parentShadowNode];
+  if (childIndexMap.empty()) {
+    childIndexMap.reserve(children.size());
+    for (size_t index = 0; index < children.size(); index++) {
+      childIndexMap.emplace(
+          &children[index]->getFamily(), static_cast<int>(index));
+    }
+  }
+
+  auto iterator = childIndexMap.find(&childFamily);
+  if (iterator != childIndexMap.end() &&
+      static_cast<size_t>(iterator->second) < children.size() &&
+      &children[iterator->second]->getFamily() == &childFamily) {
+    return iterator->second;
+  }
+
+  // Maps are keyed by the addresses of parent nodes. A node which is not a
+  // part of the indexed tree might be deallocated and its address reused by
+  // another node, so a miss is double-checked (and an outdated map dropped).
+  auto index = findChildIndex(parentShadowNode, childFamily);
+  if (index != -1) {
+    childIndexMaps_.erase(&parentShadowNode);
+  }
+  return index;
+}
+
+ShadowNode::AncestorList ShadowNodeAncestorIndex::getAncestors(
+    ShadowNodeFamily const &family,
+    ShadowNode const &ancestorShadowNode) const {
+  auto families = butter::small_vector<ShadowNodeFamily const *, 64>{};
+  auto ancestorFamily = &ancestorShadowNode.getFamily();
+
+  auto currentFamily = &family;
+  while (currentFamily && currentFamily != ancestorFamily) {
+    families.push_back(currentFamily);
+    currentFamily = currentFamily->parent_.lock().get();
+  }
+
+  if (currentFamily != ancestorFamily) {
+    return {};
+  }
+
+  auto ancestors = ShadowNode::AncestorList{};
+  auto parentNode = &ancestorShadowNode;
+  for (auto it = families.rbegin(); it != families.rend(); it++) {
+    auto childIndex = getChildIndex(*parentNode, **it);
+
+    if (childIndex == -1) {
+      ancestors.clear();
+      return ancestors;
+    }
+
+    ancestors.emplace_back(*parentNode, childIndex);
+    parentNode = parentNode->getChildren()[childIndex].get();
+  }
+
+  return ancestors;
+}
+
+ShadowNode::Shared ShadowNodeAncestorIndex::findShadowNode(
+    ShadowNodeFamily const &family) const {
+  auto ancestors = getAncestors(family, *rootShadowNode_);
+
+  if (ancestors.empty()) {
+    return nullptr;
+  }
+
+  auto &parent = ancestors.back();
+  return parent.first.get().getChildren().at(parent.second);
+}
+
+} // namespace react
+} // namespace facebook
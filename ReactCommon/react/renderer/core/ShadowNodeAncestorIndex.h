@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/core/ShadowNodeFamily.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Answers ancestor queries (see `ShadowNodeFamily::getAncestors`) against a
+ * particular immutable tree, typically a committed revision of a shadow tree.
+ *
+ * `ShadowNodeFamily::getAncestors` finds the position of every node of the
+ * path by scanning the children of its parent, which costs
+ * O(depth * siblings) per query. The index remembers, for every parent node
+ * that was visited by a query, a map from the families of its children to
+ * their indices; these maps are materialized lazily and shared among all
+ * queries, so repeated queries against the same tree cost O(depth).
+ *
+ * The object retains the root node; all methods are thread-safe.
+ */
+class ShadowNodeAncestorIndex final {
+ public:
+  using Shared = std::shared_ptr<ShadowNodeAncestorIndex const>;
+
+  explicit ShadowNodeAncestorIndex(ShadowNode::Shared rootShadowNode);
+
+  /*
+   * Returns the root node of the indexed tree.
+   */
+  ShadowNode::Shared const &getRootShadowNode() const;
+
+  /*
+   * Same as `family.getAncestors(ancestorShadowNode)`.
+   * The index is only effective if `ancestorShadowNode` is a part of the
+   * indexed tree.
+   */
+  ShadowNode::AncestorList getAncestors(
+      ShadowNodeFamily const &family,
+      ShadowNode const &ancestorShadowNode) const;
+
+  /*
+   * Returns the node of the given family in the indexed tree, or `nullptr`
+   * if the tree (except the root node itself) does not contain such a node.
+   */
+  ShadowNode::Shared findShadowNode(ShadowNodeFamily const &family) const;
+
+ private:
+  /*
+   * Returns the index of the child of the given family in the list of
+   * children of `parentShadowNode`, or `-1` if there is no such child.
+   */
+  int getChildIndex(
+      ShadowNode const &parentShadowNode,
+      ShadowNodeFamily const &childFamily) const;
+
+  using ChildIndexMap = std::unordered_map<ShadowNodeFamily const *, int>;
+
+  ShadowNode::Shared const rootShadowNode_;
+
+  mutable std::mutex mutex_;
+  mutable std::unordered_map<ShadowNode const *, ChildIndexMap>
+      childIndexMaps_; // Protected by `mutex_`.
+};
+
+} // namespace react
+} // namespace facebook
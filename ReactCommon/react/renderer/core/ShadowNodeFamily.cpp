@@ -12,6 +12,8 @@
 #include <react/renderer/core/ComponentDescriptor.h>
 #include <react/renderer/core/State.h>
 
+#include <mutex>
+#include <unordered_map>
 #include <utility>
 
 namespace facebook {
@@ -19,6 +21,21 @@ namespace react {
 
 using AncestorList = ShadowNode::AncestorList;
 
+/*
+ * Families with obsolete states, per surface.
+ * See `ShadowNodeFamily::getFamiliesWithObsoleteStates`.
+ */
+struct ObsoleteStateRegistry {
+  std::mutex mutex;
+  std::unordered_map<SurfaceId, std::vector<ShadowNodeFamily::Weak>>
+      families; // Protected by `mutex`.
+};
+
+static ObsoleteStateRegistry &obsoleteStateRegistry() {
+  static ObsoleteStateRegistry registry;
+  return registry;
+}
+
 ShadowNodeFamily::ShadowNodeFamily(
     ShadowNodeFamilyFragment const &fragment,
     EventDispatcher::Weak eventDispatcher,
@@ -103,23 +120,91 @@ State::Shared ShadowNodeFamily::getMostRecentState() const {
 }
 
 void ShadowNodeFamily::setMostRecentState(State::Shared const &state) const {
-  std::unique_lock<butter::shared_mutex> lock(mutex_);
+  auto obsoleteState = State::Shared{};
+
+  {
+    std::unique_lock<butter::shared_mutex> lock(mutex_);
+
+    /*
+     * Checking and setting `isObsolete_` prevents old states to be recommitted
+     * on top of fresher states. It's okay to commit a tree with "older" Shadow
+     * Nodes (the evolution of nodes is not linear), however, we never back out
+     * states (they progress linearly).
+     */
+    if (state && state->isObsolete_) {
+      return;
+    }
 
-  /*
-   * Checking and setting `isObsolete_` prevents old states to be recommitted
-   * on top of fresher states. It's okay to commit a tree with "older" Shadow
-   * Nodes (the evolution of nodes is not linear), however, we never back out
-   * states (they progress linearly).
-   */
-  if (state && state->isObsolete_) {
+    if (mostRecentState_ == state) {
+      return;
+    }
+
+    if (mostRecentState_) {
+      mostRecentState_->isObsolete_ = true;
+      numberOfObsoleteStates_++;
+    }
+
+    // The obsolete state must be released outside of the lock because its
+    // destructor accesses the family.
+    obsoleteState = std::exchange(mostRecentState_, state);
+  }
+
+  if (!obsoleteState) {
     return;
   }
 
-  if (mostRecentState_) {
-    mostRecentState_->isObsolete_ = true;
+  auto &registry = obsoleteStateRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  if (!isRegisteredAsObsolete_) {
+    isRegisteredAsObsolete_ = true;
+    registry.families[surfaceId_].push_back(weak_from_this());
+  }
+}
+
+std::vector<ShadowNodeFamily::Shared>
+ShadowNodeFamily::getFamiliesWithObsoleteStates(SurfaceId surfaceId) {
+  auto &registry = obsoleteStateRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  auto iterator = registry.families.find(surfaceId);
+  if (iterator == registry.families.end()) {
+    return {};
   }
 
-  mostRecentState_ = state;
+  // Collecting families that still have obsolete states and draining
+  // deallocated ones and the ones whose obsolete states are all gone
+  // (no shadow node can carry those anymore).
+  auto &weakFamilies = iterator->second;
+  auto families = std::vector<ShadowNodeFamily::Shared>{};
+  families.reserve(weakFamilies.size());
+  auto size = size_t{0};
+  for (size_t i = 0; i < weakFamilies.size(); i++) {
+    auto family = weakFamilies[i].lock();
+    if (!family) {
+      continue;
+    }
+    if (family->numberOfObsoleteStates_ == 0) {
+      family->isRegisteredAsObsolete_ = false;
+      continue;
+    }
+    families.push_back(std::move(family));
+    if (size != i) {
+      weakFamilies[size] = std::move(weakFamilies[i]);
+    }
+    size++;
+  }
+
+  if (size == 0) {
+    registry.families.erase(iterator);
+  } else {
+    weakFamilies.resize(size);
+  }
+
+  return families;
+}
+
+void ShadowNodeFamily::onObsoleteStateDeallocated() const {
+  numberOfObsoleteStates_--;
 }
 
 std::shared_ptr<State const> ShadowNodeFamily::getMostRecentStateIfObsolete(
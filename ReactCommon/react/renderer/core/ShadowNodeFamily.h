@@ -7,7 +7,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <vector>
 
 #include <butter/mutex.h>
 #include <butter/small_vector.h>
@@ -21,13 +23,15 @@ namespace react {
 
 class ComponentDescriptor;
 class ShadowNode;
+class ShadowNodeAncestorIndex;
 class State;
 
 /*
  * Represents all things that shadow nodes from the same family have in common.
  * To be used inside `ShadowNode` class *only*.
  */
-class ShadowNodeFamily final {
+class ShadowNodeFamily final
+    : public std::enable_shared_from_this<ShadowNodeFamily> {
  public:
   using Shared = std::shared_ptr<ShadowNodeFamily const>;
   using Weak = std::weak_ptr<ShadowNodeFamily const>;
@@ -80,6 +84,19 @@ class ShadowNodeFamily final {
   std::shared_ptr<State const> getMostRecentState() const;
   void setMostRecentState(std::shared_ptr<State const> const &state) const;
 
+  /*
+   * Returns all (alive) families of the given surface that have obsolete
+   * states which are still alive (i.e. some shadow node might still carry
+   * them). Nodes of other families never carry obsolete states, so state
+   * reconciliation only needs to visit these.
+   * A family is registered by `setMostRecentState` when its most recent state
+   * gets replaced by a newer one; it is unregistered by this method once all
+   * its obsolete states are deallocated.
+   * Can be called from any thread.
+   */
+  static std::vector<ShadowNodeFamily::Shared> getFamiliesWithObsoleteStates(
+      SurfaceId surfaceId);
+
   /*
    * Dispatches a state update with given priority.
    */
@@ -88,6 +105,7 @@ class ShadowNodeFamily final {
 
  private:
   friend ShadowNode;
+  friend ShadowNodeAncestorIndex;
   friend ShadowNodeFamilyFragment;
   friend State;
 
@@ -99,10 +117,29 @@ class ShadowNodeFamily final {
   std::shared_ptr<State const> getMostRecentStateIfObsolete(
       State const &state) const;
 
+  /*
+   * Must be called when an obsolete state of the family is deallocated.
+   * To be used by `State` only.
+   */
+  void onObsoleteStateDeallocated() const;
+
   EventDispatcher::Weak eventDispatcher_;
   mutable std::shared_ptr<State const> mostRecentState_;
   mutable butter::shared_mutex mutex_;
 
+  /*
+   * Number of alive `State` objects of the family that are obsolete.
+   * Incremented by `setMostRecentState`, decremented by `State` destructor.
+   */
+  mutable std::atomic<size_t> numberOfObsoleteStates_{0};
+
+  /*
+   * Indicates that the family is in the registry of families with obsolete
+   * states (see `getFamiliesWithObsoleteStates`).
+   * Protected by the mutex of the registry.
+   */
+  mutable bool isRegisteredAsObsolete_{false};
+
   /*
    * Deprecated.
    */
@@ -115,6 +115,14 @@ class ShadowNodeTraits {
     return ShadowNodeTraits::Trait(traits_ & traits) == traits;
   }
 
+  inline bool operator==(ShadowNodeTraits const &rhs) const {
+    return traits_ == rhs.traits_;
+  }
+
+  inline bool operator!=(ShadowNodeTraits const &rhs) const {
+    return traits_ != rhs.traits_;
+  }
+
  private:
   Trait traits_{Trait::None};
 };
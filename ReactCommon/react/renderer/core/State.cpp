@@ -27,6 +27,17 @@ State::State(StateData::Shared data, ShadowNodeFamily::Shared const &family)
       data_(std::move(data)),
       revision_{State::initialRevisionValue} {};
 
+State::~State() {
+  if (!isObsolete_) {
+    return;
+  }
+
+  auto family = family_.lock();
+  if (family) {
+    family->onObsoleteStateDeallocated();
+  }
+}
+
 State::Shared State::getMostRecentState() const {
   auto family = family_.lock();
   if (!family) {
@@ -40,7 +40,7 @@ class State {
       ShadowNodeFamily::Shared const &family);
 
  public:
-  virtual ~State() = default;
+  virtual ~State();
 
   /*
    * Returns a momentary value of the most recently committed state
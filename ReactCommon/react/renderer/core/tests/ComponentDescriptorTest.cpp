@@ -6,6 +6,8 @@
  */
 
 #include <gtest/gtest.h>
+#include <hermes/API/hermes/hermes.h>
+#include <jsi/JSIDynamic.h>
 
 #include <react/renderer/core/PropsParserContext.h>
 
@@ -142,3 +144,70 @@ TEST(ComponentDescriptorTest, appendChild) {
   EXPECT_EQ(node1Children.at(0), node2);
   EXPECT_EQ(node1Children.at(1), node3);
 }
+
+TEST(ComponentDescriptorTest, internProps) {
+  auto eventDispatcher = std::shared_ptr<EventDispatcher const>();
+  SharedComponentDescriptor descriptor =
+      std::make_shared<TestComponentDescriptor>(
+          ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr});
+  descriptor->setPropsInterningEnabled(true);
+
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+
+  folly::dynamic style = folly::dynamic::object("opacity", 0.5)(
+      "transform", folly::dynamic::array(folly::dynamic::object("scale", 2)));
+  auto withValue = [](folly::dynamic dynamic,
+                      std::string const &key,
+                      folly::dynamic const &value) {
+    dynamic[key] = value;
+    return dynamic;
+  };
+  auto makeProps = [&](folly::dynamic const &dynamic,
+                       SharedProps const &sourceProps = nullptr) {
+    const auto &raw = RawProps(dynamic);
+    return descriptor->cloneProps(parserContext, sourceProps, raw);
+  };
+
+  // Identical (known) values resolve to the same sealed object.
+  auto props1 = makeProps(style);
+  auto props2 = makeProps(withValue(style, "unknownProp", 42));
+  EXPECT_EQ(props1, props2);
+  EXPECT_TRUE(props1->getSealed());
+
+  auto props3 = makeProps(withValue(style, "opacity", 0.25));
+  EXPECT_NE(props1, props3);
+
+  // Source props are a part of the key.
+  auto clone1 = makeProps(folly::dynamic::object("nativeID", "a"), props1);
+  auto clone2 = makeProps(folly::dynamic::object("nativeID", "a"), props1);
+  auto clone3 = makeProps(folly::dynamic::object("nativeID", "a"), props3);
+  EXPECT_EQ(clone1, clone2);
+  EXPECT_NE(clone1, clone3);
+  EXPECT_NE(clone1, props1);
+
+  // Props with large or deep values are not interned.
+  auto largeTransform = folly::dynamic::array();
+  for (int i = 0; i < 100; i++) {
+    largeTransform.push_back(folly::dynamic::object("scale", 2));
+  }
+  auto largeStyle = withValue(style, "transform", largeTransform);
+  EXPECT_NE(makeProps(largeStyle), makeProps(largeStyle));
+  auto deepTransform = folly::dynamic::array(
+      folly::dynamic::object("scale", folly::dynamic::array(2)));
+  auto deepStyle = withValue(style, "transform", deepTransform);
+  EXPECT_NE(makeProps(deepStyle), makeProps(deepStyle));
+
+  // Props cloned from empty raw props are never shared.
+  EXPECT_NE(makeProps(nullptr, props1), makeProps(nullptr, props1));
+
+  // Values coming from JavaScript are compared with values coming from
+  // `folly::dynamic`.
+  auto runtime = facebook::hermes::makeHermesRuntime();
+  auto value = jsi::valueFromDynamic(*runtime, style);
+  const auto &raw = RawProps(*runtime, value);
+  EXPECT_EQ(descriptor->cloneProps(parserContext, nullptr, raw), props1);
+
+  descriptor->setPropsInterningEnabled(false);
+  EXPECT_NE(makeProps(style), props1);
+}
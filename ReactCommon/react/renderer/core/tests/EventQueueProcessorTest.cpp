@@ -29,6 +29,12 @@ class EventQueueProcessorTest : public testing::Test {
                          const ValueFactory &payloadFactory) {
       eventTypes_.push_back(type);
       eventPriorities_.push_back(priority);
+      if (payloadFactory) {
+        auto payload = payloadFactory(runtime);
+        if (payload.isNumber()) {
+          eventPayloads_.push_back(payload.getNumber());
+        }
+      }
     };
 
     auto dummyStatePipe = [](StateUpdate const &stateUpdate) {};
@@ -41,6 +47,7 @@ class EventQueueProcessorTest : public testing::Test {
   std::unique_ptr<EventQueueProcessor> eventProcessor_;
   std::vector<std::string> eventTypes_;
   std::vector<ReactEventPriority> eventPriorities_;
+  std::vector<double> eventPayloads_;
   ValueFactory dummyValueFactory_;
 };
 
@@ -131,4 +138,32 @@ TEST_F(EventQueueProcessorTest, alwaysDiscreteEvent) {
   EXPECT_EQ(eventPriorities_[0], ReactEventPriority::Discrete);
 }
 
+TEST_F(EventQueueProcessorTest, batchedEvent) {
+  auto batchedEvent = RawEvent(
+      "topLayout", dummyValueFactory_, nullptr, RawEvent::Category::Continuous);
+  batchedEvent.batchedEventTargets = {nullptr, nullptr, nullptr};
+  batchedEvent.batchedPayloadFactory = [](jsi::Runtime &, size_t index) {
+    return jsi::Value(static_cast<double>(index * 10));
+  };
+
+  eventProcessor_->flushEvents(
+      *runtime_,
+      {
+          std::move(batchedEvent),
+          RawEvent(
+              "onChange",
+              dummyValueFactory_,
+              nullptr,
+              RawEvent::Category::Discrete),
+      });
+
+  // Every target of the batch gets its own event, in order.
+  EXPECT_EQ(eventPriorities_.size(), 4);
+  EXPECT_EQ(eventTypes_[0], "topLayout");
+  EXPECT_EQ(eventTypes_[2], "topLayout");
+  EXPECT_EQ(eventPriorities_[2], ReactEventPriority::Default);
+  EXPECT_EQ(eventTypes_[3], "onChange");
+  EXPECT_EQ(eventPayloads_, (std::vector<double>{0, 10, 20}));
+}
+
 } // namespace facebook::react
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/API/hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/core/BatchedEventQueue.h>
+#include <react/renderer/core/EventBeat.h>
+#include <react/renderer/core/EventQueueProcessor.h>
+#include <react/renderer/core/EventTarget.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Event beat which beats on demand only.
+ */
+class ManualEventBeat final : public EventBeat {
+ public:
+  using EventBeat::beat;
+  using EventBeat::EventBeat;
+};
+
+class EventQueueTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    runtime_ = facebook::hermes::makeHermesRuntime();
+
+    auto eventPipe = [this](
+                         jsi::Runtime &runtime,
+                         const EventTarget *eventTarget,
+                         const std::string &type,
+                         ReactEventPriority priority,
+                         const ValueFactory &payloadFactory) {
+      eventTargets_.push_back(eventTarget);
+      eventTypes_.push_back(type);
+      eventPayloads_.push_back(payloadFactory(runtime).getNumber());
+    };
+
+    auto dummyStatePipe = [](StateUpdate const &stateUpdate) {};
+
+    auto eventBeat = std::make_unique<ManualEventBeat>(nullptr);
+    eventBeat_ = eventBeat.get();
+    eventQueue_ = std::make_unique<BatchedEventQueue>(
+        EventQueueProcessor(eventPipe, dummyStatePipe), std::move(eventBeat));
+
+    firstTarget_ =
+        std::make_shared<EventTarget>(*runtime_, jsi::Object(*runtime_), 1);
+    secondTarget_ =
+        std::make_shared<EventTarget>(*runtime_, jsi::Object(*runtime_), 2);
+  }
+
+  RawEvent createEvent(
+      std::string type,
+      SharedEventTarget eventTarget,
+      double payload) {
+    return RawEvent(
+        std::move(type),
+        [payload](jsi::Runtime &) { return jsi::Value(payload); },
+        std::move(eventTarget),
+        RawEvent::Category::Continuous);
+  }
+
+  RawEvent createEventBatch(
+      std::string type,
+      std::vector<SharedEventTarget> eventTargets,
+      double payload) {
+    auto event = RawEvent(
+        std::move(type),
+        ValueFactory{},
+        nullptr,
+        RawEvent::Category::Continuous);
+    event.batchedEventTargets = std::move(eventTargets);
+    event.batchedPayloadFactory = [payload](jsi::Runtime &, size_t index) {
+      return jsi::Value(payload + static_cast<double>(index) / 10);
+    };
+    return event;
+  }
+
+  void flush() {
+    eventBeat_->beat(*runtime_);
+  }
+
+  std::unique_ptr<facebook::hermes::HermesRuntime> runtime_;
+  ManualEventBeat *eventBeat_;
+  std::unique_ptr<EventQueue> eventQueue_;
+  SharedEventTarget firstTarget_;
+  SharedEventTarget secondTarget_;
+  std::vector<EventTarget const *> eventTargets_;
+  std::vector<std::string> eventTypes_;
+  std::vector<double> eventPayloads_;
+};
+
+TEST_F(EventQueueTest, uniqueEventReplacesLastEventOfSameTypeAndTarget) {
+  eventQueue_->enqueueUniqueEvent(createEvent("topScroll", firstTarget_, 1));
+  eventQueue_->enqueueEvent(createEvent("topScroll", secondTarget_, 2));
+  eventQueue_->enqueueUniqueEvent(createEvent("topScroll", firstTarget_, 3));
+
+  flush();
+
+  // The replacing event takes the place of the replaced one.
+  EXPECT_EQ(
+      eventTargets_,
+      (std::vector<EventTarget const *>{
+          firstTarget_.get(), secondTarget_.get()}));
+  EXPECT_EQ(eventPayloads_, (std::vector<double>{3, 2}));
+}
+
+TEST_F(EventQueueTest, uniqueEventKeepsOrderOfEventTypesPerTarget) {
+  eventQueue_->enqueueUniqueEvent(createEvent("topScroll", firstTarget_, 1));
+  eventQueue_->enqueueEvent(createEvent("topScrollEnd", firstTarget_, 2));
+  eventQueue_->enqueueUniqueEvent(createEvent("topScroll", firstTarget_, 3));
+
+  flush();
+
+  EXPECT_EQ(
+      eventTypes_,
+      (std::vector<std::string>{"topScroll", "topScrollEnd", "topScroll"}));
+  EXPECT_EQ(eventPayloads_, (std::vector<double>{1, 2, 3}));
+}
+
+TEST_F(EventQueueTest, uniqueEventIsQueuedAgainAfterFlush) {
+  eventQueue_->enqueueUniqueEvent(createEvent("topScroll", firstTarget_, 1));
+
+  flush();
+
+  eventQueue_->enqueueUniqueEvent(createEvent("topScroll", firstTarget_, 2));
+  eventQueue_->enqueueUniqueEvent(createEvent("topScroll", firstTarget_, 3));
+
+  flush();
+
+  EXPECT_EQ(eventPayloads_, (std::vector<double>{1, 3}));
+}
+
+TEST_F(EventQueueTest, uniqueEventDoesNotJumpOverBatchOfSameTarget) {
+  eventQueue_->enqueueUniqueEvent(createEvent("topScroll", firstTarget_, 1));
+  eventQueue_->enqueueEvent(
+      createEventBatch("topLayout", {secondTarget_, firstTarget_}, 2));
+  eventQueue_->enqueueUniqueEvent(createEvent("topScroll", firstTarget_, 3));
+
+  flush();
+
+  EXPECT_EQ(
+      eventTypes_,
+      (std::vector<std::string>{
+          "topScroll", "topLayout", "topLayout", "topScroll"}));
+  EXPECT_EQ(eventPayloads_, (std::vector<double>{1, 2, 2.1, 3}));
+}
+
+TEST_F(EventQueueTest, uniqueEventDoesNotReplaceBatch) {
+  eventQueue_->enqueueEvent(
+      createEventBatch("topLayout", {firstTarget_, secondTarget_}, 1));
+  eventQueue_->enqueueUniqueEvent(createEvent("topLayout", firstTarget_, 2));
+
+  flush();
+
+  EXPECT_EQ(
+      eventTargets_,
+      (std::vector<EventTarget const *>{
+          firstTarget_.get(), secondTarget_.get(), firstTarget_.get()}));
+  EXPECT_EQ(eventPayloads_, (std::vector<double>{1, 1.1, 2}));
+}
+
+} // namespace facebook::react
@@ -5,12 +5,16 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <cstring>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <react/debug/flags.h>
 #include <react/renderer/core/ConcreteShadowNode.h>
 #include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/core/RawPropsKeyMap.h>
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/core/propsConversions.h>
 
@@ -374,3 +378,86 @@ TEST(RawPropsTest, handlePropsMultiLookup) {
   EXPECT_NEAR(props->floatValue, 10.0, 0.00001);
   EXPECT_NEAR(props->derivedFloatValue, 20.0, 0.00001);
 }
+
+TEST(RawPropsTest, keyMapLookup) {
+  auto names = std::vector<std::string>{};
+  for (int i = 0; i < 200; i++) {
+    names.push_back("prop" + std::to_string(i));
+  }
+
+  auto map = RawPropsKeyMap{};
+  for (size_t i = 0; i < names.size(); i++) {
+    map.insert(
+        RawPropsKey{nullptr, names[i].c_str(), nullptr},
+        static_cast<RawPropsValueIndex>(i));
+  }
+  // Compound keys and duplicates (only the first one is kept).
+  map.insert(RawPropsKey{"margin", "Top", nullptr}, 200);
+  map.insert(RawPropsKey{nullptr, "marginTop", nullptr}, 201);
+  map.insert(RawPropsKey{nullptr, "prop0", nullptr}, 202);
+  map.reindex();
+
+  for (size_t i = 0; i < names.size(); i++) {
+    EXPECT_EQ(
+        map.at(names[i].c_str(), names[i].size()),
+        static_cast<RawPropsValueIndex>(i));
+  }
+  EXPECT_EQ(map.at("marginTop", 9), 200);
+
+  for (auto name : {"prop", "prop200", "prop1000", "marginTo", "x"}) {
+    EXPECT_EQ(
+        map.at(name, static_cast<RawPropsPropNameLength>(std::strlen(name))),
+        kRawPropsValueIndexEmpty);
+  }
+}
+
+TEST(RawPropsTest, propsChangeSet) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+
+  auto parser = RawPropsParser();
+  parser.prepare<Props>();
+
+  auto sourceProps = Props();
+  EXPECT_FALSE(sourceProps.changeSet.isKnown());
+
+  const auto &raw =
+      RawProps(folly::dynamic::object("nativeID", "foo")("someName", 42));
+  raw.parse(parser, parserContext);
+  auto props = Props(parserContext, sourceProps, raw);
+
+  EXPECT_TRUE(props.changeSet.isRelativeTo(sourceProps.changeSet));
+  EXPECT_EQ(props.changeSet.size(), size_t{1});
+  EXPECT_TRUE(props.changeSet.contains("nativeID"));
+  EXPECT_FALSE(props.changeSet.contains("someName"));
+  EXPECT_EQ(props.changeSet.getNames(), std::vector<std::string>{"nativeID"});
+
+  // Only the source props are described.
+  const auto &otherRaw = RawProps(folly::dynamic::object("someName", 42));
+  otherRaw.parse(parser, parserContext);
+  auto otherProps = Props(parserContext, props, otherRaw);
+
+  EXPECT_TRUE(otherProps.changeSet.isRelativeTo(props.changeSet));
+  EXPECT_FALSE(otherProps.changeSet.isRelativeTo(sourceProps.changeSet));
+  EXPECT_EQ(otherProps.changeSet.size(), size_t{0});
+
+  // Props cloned from empty raw props, copies and mutated props are unknown.
+  const auto &emptyRaw = RawProps();
+  emptyRaw.parse(parser, parserContext);
+  EXPECT_FALSE(Props(parserContext, props, emptyRaw).changeSet.isKnown());
+
+  auto copiedProps = props;
+  EXPECT_FALSE(copiedProps.changeSet.isKnown());
+  EXPECT_FALSE(otherProps.changeSet.isRelativeTo(copiedProps.changeSet));
+
+  props.changeSet.invalidate();
+  EXPECT_FALSE(props.changeSet.isKnown());
+  EXPECT_FALSE(otherProps.changeSet.isRelativeTo(props.changeSet));
+
+  // The empty set is known but not relative to any props.
+  const auto &emptyChangeSet = PropsChangeSet::empty();
+  EXPECT_TRUE(emptyChangeSet.isKnown());
+  EXPECT_EQ(emptyChangeSet.size(), size_t{0});
+  EXPECT_FALSE(emptyChangeSet.contains("nativeID"));
+  EXPECT_FALSE(emptyChangeSet.isRelativeTo(sourceProps.changeSet));
+}
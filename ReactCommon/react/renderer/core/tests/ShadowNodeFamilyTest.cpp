@@ -11,6 +11,7 @@
 
 #include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
 #include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/ShadowNodeAncestorIndex.h>
 #include <react/renderer/element/ComponentBuilder.h>
 #include <react/renderer/element/Element.h>
 
@@ -77,3 +78,77 @@ TEST(ShadowNodeFamilyTest, sealObjectCorrectly) {
   EXPECT_EQ(&ancestors2[0].first.get(), shadowNodeA.get());
   EXPECT_EQ(&ancestors2[1].first.get(), shadowNodeAA.get());
 }
+
+TEST(ShadowNodeFamilyTest, ancestorIndex) {
+  /*
+   * The structure:
+   * <A>
+   *  <AA/> ... <AT>   (20 children)
+   *    <ATA/>
+   *  </AT>
+   * </A>
+   */
+  ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry{};
+  auto eventDispatcher = EventDispatcher::Shared{};
+  auto componentDescriptorRegistry =
+      componentDescriptorProviderRegistry.createComponentDescriptorRegistry(
+          ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr});
+
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+
+  auto builder = ComponentBuilder{componentDescriptorRegistry};
+
+  auto shadowNodeAT = std::shared_ptr<ViewShadowNode>{};
+  auto shadowNodeATA = std::shared_ptr<ViewShadowNode>{};
+
+  auto children = std::vector<ElementFragment>{};
+  for (int i = 0; i < 19; i++) {
+    children.push_back(Element<ViewShadowNode>().tag(10 + i));
+  }
+  // clang-format off
+  children.push_back(
+      Element<ViewShadowNode>()
+        .tag(2)
+        .reference(shadowNodeAT)
+        .children({
+          Element<ViewShadowNode>()
+            .tag(3)
+            .reference(shadowNodeATA)
+        }));
+  auto elementA =
+      Element<ViewShadowNode>()
+        .tag(1)
+        .children(children);
+  // clang-format on
+
+  auto shadowNodeA = builder.build(elementA);
+  auto ancestorIndex = ShadowNodeAncestorIndex{shadowNodeA};
+
+  // The index gives the same answers as the family.
+  for (int i = 0; i < 2; i++) {
+    auto ancestors =
+        ancestorIndex.getAncestors(shadowNodeATA->getFamily(), *shadowNodeA);
+    ASSERT_EQ(ancestors.size(), 2);
+    EXPECT_EQ(&ancestors[0].first.get(), shadowNodeA.get());
+    EXPECT_EQ(ancestors[0].second, 19);
+    EXPECT_EQ(&ancestors[1].first.get(), shadowNodeAT.get());
+    EXPECT_EQ(ancestors[1].second, 0);
+  }
+
+  EXPECT_EQ(
+      ancestorIndex.findShadowNode(shadowNodeATA->getFamily()), shadowNodeATA);
+  EXPECT_EQ(ancestorIndex.findShadowNode(shadowNodeA->getFamily()), nullptr);
+
+  // Relative to a node inside of the tree.
+  auto ancestors =
+      ancestorIndex.getAncestors(shadowNodeATA->getFamily(), *shadowNodeAT);
+  ASSERT_EQ(ancestors.size(), 1);
+  EXPECT_EQ(&ancestors[0].first.get(), shadowNodeAT.get());
+
+  // Negative case: not an ancestor.
+  EXPECT_EQ(
+      ancestorIndex.getAncestors(shadowNodeAT->getFamily(), *shadowNodeATA)
+          .size(),
+      0);
+}
@@ -292,3 +292,78 @@ TEST_F(ShadowNodeTest, handleState) {
       { secondNode->setStateData(TestState{42}); },
       "Attempt to mutate a sealed object.");
 }
+
+TEST_F(ShadowNodeTest, handleMountGenerations) {
+  nodeA_->stampMountGenerationRecursive();
+  EXPECT_NE(nodeA_->getMountGeneration(), ShadowNode::MountGeneration{0});
+  EXPECT_NE(nodeABA_->getMountGeneration(), ShadowNode::MountGeneration{0});
+  EXPECT_NE(nodeAA_->getMountGeneration(), nodeAC_->getMountGeneration());
+
+  // Cloning without changing anything (e.g. a layout-only clone) keeps the
+  // generation of the whole path.
+  auto nodeABARevision2 = nodeABA_->clone({});
+  auto nodeABRevision2 = nodeAB_->clone({});
+  nodeABRevision2->replaceChild(*nodeABA_, nodeABARevision2);
+  auto nodeARevision2 = nodeA_->clone(ShadowNodeFragment{
+      ShadowNodeFragment::propsPlaceholder(),
+      std::make_shared<SharedShadowNodeList>(
+          SharedShadowNodeList{nodeAA_, nodeABRevision2, nodeAC_})});
+
+  nodeARevision2->stampMountGenerationRecursive();
+  EXPECT_EQ(
+      nodeABARevision2->getMountGeneration(), nodeABA_->getMountGeneration());
+  EXPECT_EQ(
+      nodeABRevision2->getMountGeneration(), nodeAB_->getMountGeneration());
+  EXPECT_EQ(nodeARevision2->getMountGeneration(), nodeA_->getMountGeneration());
+  EXPECT_TRUE(ShadowNode::areSubtreesMountEquivalent(*nodeA_, *nodeARevision2));
+
+  // Changing props of a leaf changes the generation of all its ancestors,
+  // but not of its siblings.
+  auto nodeABARevision3 = nodeABA_->clone(
+      ShadowNodeFragment{std::make_shared<TestProps const>()});
+  auto nodeABRevision3 = nodeAB_->clone(ShadowNodeFragment{
+      ShadowNodeFragment::propsPlaceholder(),
+      std::make_shared<SharedShadowNodeList>(
+          SharedShadowNodeList{nodeABARevision3, nodeABB_})});
+  auto nodeARevision3 = nodeARevision2->clone(ShadowNodeFragment{
+      ShadowNodeFragment::propsPlaceholder(),
+      std::make_shared<SharedShadowNodeList>(
+          SharedShadowNodeList{nodeAA_, nodeABRevision3, nodeAC_})});
+
+  nodeARevision3->stampMountGenerationRecursive();
+  EXPECT_NE(
+      nodeABARevision3->getMountGeneration(), nodeABA_->getMountGeneration());
+  EXPECT_NE(
+      nodeABRevision3->getMountGeneration(), nodeAB_->getMountGeneration());
+  EXPECT_NE(nodeARevision3->getMountGeneration(), nodeA_->getMountGeneration());
+  EXPECT_FALSE(
+      ShadowNode::areSubtreesMountEquivalent(*nodeA_, *nodeARevision3));
+  EXPECT_TRUE(ShadowNode::areSubtreesMountEquivalent(*nodeABB_, *nodeABB_));
+
+  // Nodes that were never stamped are never considered equivalent.
+  EXPECT_FALSE(ShadowNode::areSubtreesMountEquivalent(
+      *nodeZ_, *nodeZ_->clone({})));
+}
+
+TEST_F(ShadowNodeTest, handleSealAndStamp) {
+  // Visiting the tree bottom-up with `sealAndStamp` is equivalent to
+  // `sealRecursive` followed by `stampMountGenerationRecursive`.
+  for (auto const &node : {nodeABA_, nodeABB_, nodeAB_, nodeAA_, nodeAC_}) {
+    node->sealAndStamp();
+  }
+  nodeA_->sealAndStamp();
+
+  EXPECT_TRUE(nodeA_->getSealed());
+  EXPECT_TRUE(nodeABA_->getSealed());
+  EXPECT_NE(nodeA_->getMountGeneration(), ShadowNode::MountGeneration{0});
+  EXPECT_NE(nodeAB_->getMountGeneration(), nodeAC_->getMountGeneration());
+
+  // Already stamped nodes keep their generation.
+  auto generation = nodeA_->getMountGeneration();
+  nodeA_->sealAndStamp();
+  EXPECT_EQ(nodeA_->getMountGeneration(), generation);
+
+  auto nodeARevision2 = nodeA_->clone({});
+  nodeARevision2->sealAndStamp();
+  EXPECT_TRUE(ShadowNode::areSubtreesMountEquivalent(*nodeA_, *nodeARevision2));
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/API/hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/core/BatchedEventQueue.h>
+#include <react/renderer/core/EventBeat.h>
+#include <react/renderer/core/EventQueueProcessor.h>
+#include <react/renderer/core/EventTarget.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+static constexpr int kNumberOfTargets = 50;
+static constexpr int kEventsPerSecond = 10000;
+
+/*
+ * Event beat which beats on demand only.
+ */
+class BenchmarkEventBeat final : public EventBeat {
+ public:
+  using EventBeat::beat;
+  using EventBeat::EventBeat;
+};
+
+static jsi::Runtime &eventQueueRuntime() {
+  static auto const runtime = facebook::hermes::makeHermesRuntime();
+  return *runtime;
+}
+
+static std::vector<SharedEventTarget> const &eventTargets() {
+  static auto const eventTargets = [] {
+    auto &runtime = eventQueueRuntime();
+    auto eventTargets = std::vector<SharedEventTarget>{};
+    for (int tag = 1; tag <= kNumberOfTargets; tag++) {
+      eventTargets.push_back(
+          std::make_shared<EventTarget>(runtime, jsi::Object(runtime), tag));
+    }
+    return eventTargets;
+  }();
+  return eventTargets;
+}
+
+static std::unique_ptr<EventQueue> createEventQueue(
+    BenchmarkEventBeat *&eventBeat,
+    std::atomic<size_t> &numberOfDispatchedEvents) {
+  auto eventPipe = [&numberOfDispatchedEvents](
+                       jsi::Runtime &,
+                       const EventTarget *,
+                       const std::string &,
+                       ReactEventPriority,
+                       const ValueFactory &) {
+    numberOfDispatchedEvents.fetch_add(1, std::memory_order_relaxed);
+  };
+  auto statePipe = [](StateUpdate const &) {};
+
+  auto ownedEventBeat = std::make_unique<BenchmarkEventBeat>(nullptr);
+  eventBeat = ownedEventBeat.get();
+  return std::make_unique<BatchedEventQueue>(
+      EventQueueProcessor(eventPipe, statePipe), std::move(ownedEventBeat));
+}
+
+static RawEvent createScrollEvent(int index) {
+  return RawEvent(
+      "topScroll",
+      [index](jsi::Runtime &) { return jsi::Value(index); },
+      eventTargets()[index % kNumberOfTargets],
+      RawEvent::Category::Continuous);
+}
+
+/*
+ * Cost of enqueueing a unique event while the queue is not being flushed,
+ * which is the case whenever the JavaScript thread is busy.
+ */
+static void enqueueUniqueEvents(benchmark::State &state) {
+  auto numberOfDispatchedEvents = std::atomic<size_t>{0};
+  BenchmarkEventBeat *eventBeat = nullptr;
+  auto eventQueue = createEventQueue(eventBeat, numberOfDispatchedEvents);
+  auto index = 0;
+
+  for (auto _ : state) {
+    eventQueue->enqueueUniqueEvent(createScrollEvent(index++));
+    if (index % 1000 == 0) {
+      state.PauseTiming();
+      eventBeat->beat(eventQueueRuntime());
+      state.ResumeTiming();
+    }
+  }
+}
+BENCHMARK(enqueueUniqueEvents);
+
+/*
+ * A UI thread emits 10k unique events per second across 50 targets while
+ * the JavaScript thread flushes the queue on every beat. Reports the
+ * longest time a single enqueue took and how many events were left after
+ * coalescing.
+ */
+static void enqueueUniqueEventsWhileFlushing(benchmark::State &state) {
+  auto numberOfDispatchedEvents = std::atomic<size_t>{0};
+  BenchmarkEventBeat *eventBeat = nullptr;
+  auto eventQueue = createEventQueue(eventBeat, numberOfDispatchedEvents);
+  auto &runtime = eventQueueRuntime();
+  auto const numberOfEvents = static_cast<int>(state.range(0));
+  auto const eventInterval =
+      std::chrono::nanoseconds(std::chrono::seconds(1)) / kEventsPerSecond;
+  auto longestEnqueue = std::chrono::nanoseconds{0};
+
+  for (auto _ : state) {
+    auto isProducing = std::atomic_bool{true};
+    auto producer = std::thread([&]() {
+      auto nextEventTime = std::chrono::steady_clock::now();
+      for (int index = 0; index < numberOfEvents; index++) {
+        std::this_thread::sleep_until(nextEventTime);
+        nextEventTime += eventInterval;
+
+        auto start = std::chrono::steady_clock::now();
+        eventQueue->enqueueUniqueEvent(createScrollEvent(index));
+        longestEnqueue =
+            std::max(longestEnqueue, std::chrono::steady_clock::now() - start);
+      }
+      isProducing = false;
+    });
+
+    while (isProducing) {
+      eventBeat->beat(runtime);
+      std::this_thread::yield();
+    }
+    producer.join();
+    eventBeat->beat(runtime);
+  }
+
+  state.counters["longestEnqueueNs"] =
+      static_cast<double>(longestEnqueue.count());
+  state.counters["dispatchedEvents"] = benchmark::Counter(
+      static_cast<double>(numberOfDispatchedEvents),
+      benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(enqueueUniqueEventsWhileFlushing)
+    ->Arg(kEventsPerSecond / 10)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+} // namespace react
+} // namespace facebook
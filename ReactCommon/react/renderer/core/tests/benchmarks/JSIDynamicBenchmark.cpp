@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <folly/json.h>
+#include <hermes/API/hermes/hermes.h>
+#include <jsi/JSIDynamic.h>
+#include <jsi/jsi.h>
+#include <memory>
+#include <string>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Payloads which are typical for `JSIExecutor::callNativeModules`,
+ * TurboModules and events.
+ */
+static folly::dynamic const &flatPayload() {
+  static auto const payload = folly::parseJson(R"({
+    "target": 42, "timestamp": 1234567.5, "pageX": 120.5, "pageY": 240,
+    "locationX": 20.5, "locationY": 40, "identifier": 1, "force": 0,
+    "type": "touchstart", "isPrimary": true, "pointerType": "touch"})");
+  return payload;
+}
+
+static folly::dynamic const &nestedPayload() {
+  static auto const payload = folly::parseJson(R"({
+    "nativeEvent": {
+      "contentOffset": {"x": 0, "y": 1024.5},
+      "contentInset": {"top": 0, "left": 0, "bottom": 0, "right": 0},
+      "contentSize": {"width": 375, "height": 12000},
+      "layoutMeasurement": {"width": 375, "height": 812},
+      "zoomScale": 1,
+      "velocity": {"x": 0, "y": -1.25},
+      "target": 42,
+      "responderIgnoreScroll": true}})");
+  return payload;
+}
+
+static folly::dynamic const &arrayHeavyPayload() {
+  static auto const payload = [] {
+    auto touches = folly::dynamic::array();
+    for (int i = 0; i < 100; i++) {
+      touches.push_back(folly::dynamic::object("identifier", i)(
+          "pageX", i * 1.5)("pageY", i * 2.5)("locationX", i)("locationY", i)(
+          "target", 42)("timestamp", 1234567.5));
+    }
+    auto values = folly::dynamic::array();
+    for (int i = 0; i < 1000; i++) {
+      values.push_back(i * 0.5);
+    }
+    return folly::dynamic::object("touches", touches)(
+        "changedTouches", touches)("values", values);
+  }();
+  return payload;
+}
+
+static jsi::Runtime &runtime() {
+  static auto const runtime = facebook::hermes::makeHermesRuntime();
+  return *runtime;
+}
+
+static void valueFromDynamic(
+    benchmark::State &state,
+    folly::dynamic const &payload) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(jsi::valueFromDynamic(runtime(), payload));
+  }
+}
+
+static void dynamicFromValue(
+    benchmark::State &state,
+    folly::dynamic const &payload) {
+  auto value = jsi::valueFromDynamic(runtime(), payload);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(jsi::dynamicFromValue(runtime(), value));
+  }
+}
+
+static void valueFromFlatDynamic(benchmark::State &state) {
+  valueFromDynamic(state, flatPayload());
+}
+BENCHMARK(valueFromFlatDynamic);
+
+static void valueFromNestedDynamic(benchmark::State &state) {
+  valueFromDynamic(state, nestedPayload());
+}
+BENCHMARK(valueFromNestedDynamic);
+
+static void valueFromArrayHeavyDynamic(benchmark::State &state) {
+  valueFromDynamic(state, arrayHeavyPayload());
+}
+BENCHMARK(valueFromArrayHeavyDynamic);
+
+static void dynamicFromFlatValue(benchmark::State &state) {
+  dynamicFromValue(state, flatPayload());
+}
+BENCHMARK(dynamicFromFlatValue);
+
+static void dynamicFromNestedValue(benchmark::State &state) {
+  dynamicFromValue(state, nestedPayload());
+}
+BENCHMARK(dynamicFromNestedValue);
+
+static void dynamicFromArrayHeavyValue(benchmark::State &state) {
+  dynamicFromValue(state, arrayHeavyPayload());
+}
+BENCHMARK(dynamicFromArrayHeavyValue);
+
+} // namespace react
+} // namespace facebook
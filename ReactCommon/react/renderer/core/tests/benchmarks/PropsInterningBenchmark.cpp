@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/EventDispatcher.h>
+#include <react/renderer/core/RawProps.h>
+#include <react/utils/ContextContainer.h>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <unordered_set>
+#include <vector>
+
+/*
+ * Counts the bytes which are currently allocated through the global
+ * `operator new`, so the memory counters include everything props objects
+ * (and the interner) retain. Note that this applies to all benchmarks linked
+ * into the binary; the bookkeeping is a few instructions per allocation.
+ */
+static std::atomic<size_t> liveHeapBytes{0};
+
+// Keeps allocations aligned for any fundamental type.
+constexpr static size_t kAllocationHeaderSize = alignof(std::max_align_t);
+
+void *operator new(size_t size) {
+  auto pointer = static_cast<char *>(std::malloc(size + kAllocationHeaderSize));
+  if (pointer == nullptr) {
+    throw std::bad_alloc{};
+  }
+  *reinterpret_cast<size_t *>(pointer) = size;
+  liveHeapBytes += size;
+  return pointer + kAllocationHeaderSize;
+}
+
+void operator delete(void *pointer) noexcept {
+  if (pointer == nullptr) {
+    return;
+  }
+  auto header = static_cast<char *>(pointer) - kAllocationHeaderSize;
+  liveHeapBytes -= *reinterpret_cast<size_t *>(header);
+  std::free(header);
+}
+
+void operator delete(void *pointer, size_t /*size*/) noexcept {
+  operator delete(pointer);
+}
+
+namespace facebook {
+namespace react {
+
+/*
+ * Creates props of a synthetic 10,000-row list (three views per row, styled
+ * from a "stylesheet"; every tenth row is highlighted) and reports how many
+ * distinct props objects the list retains and how much heap memory they
+ * (including the entries of the interner) take, along with the inline size
+ * of `ViewProps`. The argument enables props interning.
+ */
+static void propsOfTenThousandRowList(benchmark::State &state) {
+  auto isInterningEnabled = state.range(0) == 1;
+
+  auto contextContainer = std::make_shared<ContextContainer const>();
+  auto componentDescriptor =
+      ViewComponentDescriptor{ComponentDescriptorParameters{
+          EventDispatcher::Shared{}, contextContainer, nullptr}};
+  componentDescriptor.setPropsInterningEnabled(isInterningEnabled);
+
+  auto parserContextContainer = ContextContainer{};
+  auto parserContext = PropsParserContext{1, parserContextContainer};
+
+  folly::dynamic rowStyle = folly::dynamic::object("flexDirection", "row")(
+      "padding", 8)("borderBottomWidth", 1)("backgroundColor", 0xffffffff);
+  folly::dynamic highlightedRowStyle = folly::dynamic::object(
+      "flexDirection", "row")("padding", 8)("borderBottomWidth", 1)(
+      "backgroundColor", 0xffffeeaa);
+  folly::dynamic avatarStyle = folly::dynamic::object("width", 40)(
+      "height", 40)("borderRadius", 20)("overflow", "hidden")(
+      "transform", folly::dynamic::array(folly::dynamic::object("scale", 1)));
+  folly::dynamic labelStyle = folly::dynamic::object("flex", 1)(
+      "marginLeft", 8)("justifyContent", "center")("opacity", 0.87);
+
+  constexpr int kNumberOfRows = 10000;
+  auto props = std::vector<SharedProps>{};
+  props.reserve(kNumberOfRows * 3);
+
+  auto makeProps = [&](folly::dynamic const &dynamic) {
+    const auto &rawProps = RawProps(dynamic);
+    return componentDescriptor.cloneProps(parserContext, nullptr, rawProps);
+  };
+
+  auto buildList = [&]() {
+    for (int i = 0; i < kNumberOfRows; i++) {
+      props.push_back(makeProps(i % 10 == 0 ? highlightedRowStyle : rowStyle));
+      props.push_back(makeProps(avatarStyle));
+      props.push_back(makeProps(labelStyle));
+    }
+  };
+
+  // Measured on the first build, so the interner holds no stale entries yet.
+  // `props` has enough capacity, so only props objects (and entries of the
+  // interner) are allocated while the list is built.
+  auto liveHeapBytesBefore = liveHeapBytes.load();
+  buildList();
+  auto retainedBytes = liveHeapBytes.load() - liveHeapBytesBefore;
+
+  for (auto _ : state) {
+    props.clear();
+    buildList();
+    benchmark::DoNotOptimize(props);
+  }
+
+  auto distinctProps = std::unordered_set<Props const *>{};
+  for (auto const &item : props) {
+    distinctProps.insert(item.get());
+  }
+
+  state.counters["propsObjects"] = static_cast<double>(distinctProps.size());
+  state.counters["retainedBytes"] = static_cast<double>(retainedBytes);
+  state.counters["viewPropsBytes"] = static_cast<double>(sizeof(ViewProps));
+}
+BENCHMARK(propsOfTenThousandRowList)
+    ->ArgName("interning")
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace react
+} // namespace facebook
@@ -8,6 +8,9 @@
 #include <benchmark/benchmark.h>
 #include <folly/dynamic.h>
 #include <folly/json.h>
+#include <hermes/API/hermes/hermes.h>
+#include <jsi/JSIDynamic.h>
+#include <jsi/jsi.h>
 #include <react/renderer/components/view/ViewComponentDescriptor.h>
 #include <react/renderer/core/EventDispatcher.h>
 #include <react/renderer/core/RawProps.h>
@@ -32,6 +35,15 @@ auto propsStringWithSomeUnsupportedProps = std::string{
 auto unsupportedPropsDynamic =
     folly::parseJson(propsStringWithSomeUnsupportedProps);
 
+auto propsStringWithTransform = std::string{
+    R"({"flex": 1, "padding": 10, "opacity": 0.5, "nativeID": "some-id", "transform": [{"translateX": 10}, {"translateY": 20}, {"rotate": "45deg"}, {"scale": 2}], "someName1": {"someName2": [1, 2, 3, 4, 5, 6, 7, 8]}})"};
+auto propsWithTransformDynamic = folly::parseJson(propsStringWithTransform);
+
+auto runtime = facebook::hermes::makeHermesRuntime();
+auto propsValue = jsi::valueFromDynamic(*runtime, propsDynamic);
+auto propsWithTransformValue =
+    jsi::valueFromDynamic(*runtime, propsWithTransformDynamic);
+
 auto sourceProps = ViewProps{};
 auto sharedSourceProps = ViewShadowNode::defaultSharedProps();
 
@@ -83,6 +95,61 @@ static void propParsingRegularRawPropsWithNoSourceProps(
 }
 BENCHMARK(propParsingRegularRawPropsWithNoSourceProps);
 
+/*
+ * The following benchmarks compare parsing of `folly::dynamic`-backed raw
+ * props with parsing of the same props coming from a JavaScript object (which
+ * are read lazily and never converted to `folly::dynamic`).
+ */
+static void propParsingJSIRawProps(benchmark::State &state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  for (auto _ : state) {
+    viewComponentDescriptor.cloneProps(
+        parserContext, sharedSourceProps, RawProps{*runtime, propsValue});
+  }
+}
+BENCHMARK(propParsingJSIRawProps);
+
+static void propParsingRawPropsWithTransform(benchmark::State &state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  for (auto _ : state) {
+    viewComponentDescriptor.cloneProps(
+        parserContext,
+        sharedSourceProps,
+        RawProps{propsWithTransformDynamic});
+  }
+}
+BENCHMARK(propParsingRawPropsWithTransform);
+
+static void propParsingJSIRawPropsWithTransform(benchmark::State &state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  for (auto _ : state) {
+    viewComponentDescriptor.cloneProps(
+        parserContext,
+        sharedSourceProps,
+        RawProps{*runtime, propsWithTransformValue});
+  }
+}
+BENCHMARK(propParsingJSIRawPropsWithTransform);
+
+/*
+ * Mimics the JSI path as it was before `RawValue` could hold a `jsi::Value`:
+ * the whole object is converted to `folly::dynamic` first.
+ */
+static void propParsingJSIRawPropsViaDynamic(benchmark::State &state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  for (auto _ : state) {
+    viewComponentDescriptor.cloneProps(
+        parserContext,
+        sharedSourceProps,
+        RawProps{jsi::dynamicFromValue(*runtime, propsWithTransformValue)});
+  }
+}
+BENCHMARK(propParsingJSIRawPropsViaDynamic);
+
 } // namespace react
 } // namespace facebook
 
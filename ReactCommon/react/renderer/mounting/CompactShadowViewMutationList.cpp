@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "CompactShadowViewMutationList.h"
+
+#include <limits>
+#include <utility>
+
+#include <react/debug/react_native_assert.h>
+
+namespace facebook {
+namespace react {
+
+using ShadowViewIndex = CompactShadowViewMutationList::ShadowViewIndex;
+
+/*
+ * Unlike `ShadowView::operator==`, compares every member (including all
+ * members which `std::hash<ShadowView>` takes into account), so mutations
+ * only share a view which is identical to the one they were created with.
+ */
+static bool areShadowViewsIdentical(
+    ShadowView const &lhs,
+    ShadowView const &rhs) {
+  return lhs == rhs && lhs.componentHandle == rhs.componentHandle &&
+      lhs.traits == rhs.traits;
+}
+
+CompactShadowViewMutationList::CompactShadowViewMutationList() {
+  shadowViews_.emplace_back();
+}
+
+CompactShadowViewMutationList::CompactShadowViewMutationList(
+    ShadowViewMutationList &&mutations)
+    : CompactShadowViewMutationList() {
+  reserve(mutations.size());
+  for (auto &mutation : mutations) {
+    push_back(std::move(mutation));
+  }
+  mutations.clear();
+  shrinkToFit();
+}
+
+void CompactShadowViewMutationList::reserve(size_t mutationCount) {
+  mutations_.reserve(mutationCount);
+}
+
+void CompactShadowViewMutationList::shrinkToFit() {
+  // `clear()` keeps the buckets allocated; swapping with an empty map does
+  // not.
+  std::unordered_multimap<size_t, ShadowViewIndex>{}.swap(shadowViewIndices_);
+  mutations_.shrink_to_fit();
+  shadowViews_.shrink_to_fit();
+}
+
+void CompactShadowViewMutationList::push_back(
+    ShadowViewMutation const &mutation) {
+  append(mutation);
+}
+
+void CompactShadowViewMutationList::push_back(ShadowViewMutation &&mutation) {
+  append(std::move(mutation));
+}
+
+size_t CompactShadowViewMutationList::size() const {
+  return mutations_.size();
+}
+
+bool CompactShadowViewMutationList::empty() const {
+  return mutations_.empty();
+}
+
+CompactShadowViewMutation const &
+CompactShadowViewMutationList::getCompactMutation(size_t index) const {
+  return mutations_[index];
+}
+
+ShadowView const &CompactShadowViewMutationList::getShadowView(
+    ShadowViewIndex index) const {
+  return shadowViews_[index];
+}
+
+size_t CompactShadowViewMutationList::getShadowViewCount() const {
+  return shadowViews_.size();
+}
+
+bool CompactShadowViewMutationList::mutatedViewIsVirtual(size_t index) const {
+  bool viewIsVirtual = false;
+
+#ifdef ANDROID
+  // Mirrors `ShadowViewMutation::mutatedViewIsVirtual()`: both the old and
+  // the new view have to be checked.
+  auto const &mutation = mutations_[index];
+  viewIsVirtual = shadowViews_[mutation.newChildShadowView].layoutMetrics ==
+          EmptyLayoutMetrics &&
+      shadowViews_[mutation.oldChildShadowView].layoutMetrics ==
+          EmptyLayoutMetrics;
+#else
+  (void)index;
+#endif
+
+  return viewIsVirtual;
+}
+
+ShadowViewMutation CompactShadowViewMutationList::getMutation(
+    size_t index) const {
+  auto const &mutation = mutations_[index];
+  return ShadowViewMutation{
+      mutation.type,
+      shadowViews_[mutation.parentShadowView],
+      shadowViews_[mutation.oldChildShadowView],
+      shadowViews_[mutation.newChildShadowView],
+      mutation.index};
+}
+
+CompactShadowViewMutationList::ConstIterator
+CompactShadowViewMutationList::begin() const {
+  return ConstIterator{*this, 0};
+}
+
+CompactShadowViewMutationList::ConstIterator
+CompactShadowViewMutationList::end() const {
+  return ConstIterator{*this, mutations_.size()};
+}
+
+ShadowViewMutationList CompactShadowViewMutationList::toList() const {
+  auto mutations = ShadowViewMutationList{};
+  mutations.reserve(mutations_.size());
+  for (size_t index = 0; index < mutations_.size(); index++) {
+    mutations.push_back(getMutation(index));
+  }
+  return mutations;
+}
+
+#pragma mark - Private
+
+template <typename ShadowViewT>
+ShadowViewIndex CompactShadowViewMutationList::intern(
+    ShadowViewT &&shadowView) {
+  constexpr auto kEmptyShadowViewIndex =
+      CompactShadowViewMutation::kEmptyShadowViewIndex;
+  if (areShadowViewsIdentical(
+          shadowView, shadowViews_[kEmptyShadowViewIndex])) {
+    return kEmptyShadowViewIndex;
+  }
+
+  auto hash = std::hash<ShadowView>{}(shadowView);
+  auto range = shadowViewIndices_.equal_range(hash);
+  for (auto it = range.first; it != range.second; it++) {
+    if (areShadowViewsIdentical(shadowViews_[it->second], shadowView)) {
+      return it->second;
+    }
+  }
+
+  react_native_assert(
+      shadowViews_.size() < std::numeric_limits<ShadowViewIndex>::max());
+  auto index = static_cast<ShadowViewIndex>(shadowViews_.size());
+  shadowViews_.push_back(std::forward<ShadowViewT>(shadowView));
+  shadowViewIndices_.emplace(hash, index);
+  return index;
+}
+
+template <typename ShadowViewMutationT>
+void CompactShadowViewMutationList::append(ShadowViewMutationT &&mutation) {
+  auto compactMutation = CompactShadowViewMutation{};
+  compactMutation.type = mutation.type;
+  compactMutation.index = mutation.index;
+  compactMutation.parentTag = mutation.parentShadowView.tag;
+  compactMutation.childTag = mutation.newChildShadowView.tag != 0
+      ? mutation.newChildShadowView.tag
+      : mutation.oldChildShadowView.tag;
+  compactMutation.parentShadowView =
+      intern(std::forward<ShadowViewMutationT>(mutation).parentShadowView);
+  compactMutation.oldChildShadowView =
+      intern(std::forward<ShadowViewMutationT>(mutation).oldChildShadowView);
+  compactMutation.newChildShadowView =
+      intern(std::forward<ShadowViewMutationT>(mutation).newChildShadowView);
+  mutations_.push_back(compactMutation);
+}
+
+} // namespace react
+} // namespace facebook
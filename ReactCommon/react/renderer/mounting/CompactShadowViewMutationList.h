@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <react/renderer/mounting/ShadowView.h>
+#include <react/renderer/mounting/ShadowViewMutation.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * A `ShadowViewMutation` encoded as a small POD: instead of three `ShadowView`
+ * objects, it stores offsets into the (deduplicated) table of `ShadowView`s
+ * owned by `CompactShadowViewMutationList`. Tags are stored inline so that
+ * consumers that only need them do not have to touch the table at all.
+ */
+struct CompactShadowViewMutation final {
+  using ShadowViewIndex = uint32_t;
+
+  /*
+   * The table always stores an empty `ShadowView` at this offset.
+   */
+  constexpr static ShadowViewIndex kEmptyShadowViewIndex = 0;
+
+  ShadowViewMutation::Type type{ShadowViewMutation::Create};
+  int index{-1};
+  Tag parentTag{};
+  Tag childTag{};
+  ShadowViewIndex parentShadowView{kEmptyShadowViewIndex};
+  ShadowViewIndex oldChildShadowView{kEmptyShadowViewIndex};
+  ShadowViewIndex newChildShadowView{kEmptyShadowViewIndex};
+};
+
+static_assert(
+    std::is_trivially_copyable<CompactShadowViewMutation>::value,
+    "`CompactShadowViewMutation` must be trivially copyable.");
+
+/*
+ * An alternative representation of `ShadowViewMutationList`.
+ * Every distinct `ShadowView` (e.g. a parent that receives many `Insert`s, or
+ * a view that is both created and inserted) is stored only once, so building,
+ * moving and destroying the list involves far fewer `ShadowView` copies and
+ * reference-count changes.
+ *
+ * Existing consumers can iterate over the list as if it was a
+ * `ShadowViewMutationList`: the iterator decodes mutations one at a time.
+ */
+class CompactShadowViewMutationList final {
+ public:
+  using ShadowViewIndex = CompactShadowViewMutation::ShadowViewIndex;
+
+  /*
+   * Input iterator that yields decoded `ShadowViewMutation`s by value.
+   */
+  class ConstIterator final {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = ShadowViewMutation;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = ShadowViewMutation;
+
+    ConstIterator(CompactShadowViewMutationList const &list, size_t index)
+        : list_(&list), index_(index) {}
+
+    ShadowViewMutation operator*() const {
+      return list_->getMutation(index_);
+    }
+
+    ConstIterator &operator++() {
+      index_++;
+      return *this;
+    }
+
+    ConstIterator operator++(int) {
+      auto copy = *this;
+      index_++;
+      return copy;
+    }
+
+    bool operator==(ConstIterator const &rhs) const {
+      return list_ == rhs.list_ && index_ == rhs.index_;
+    }
+
+    bool operator!=(ConstIterator const &rhs) const {
+      return !(*this == rhs);
+    }
+
+   private:
+    CompactShadowViewMutationList const *list_;
+    size_t index_;
+  };
+
+  CompactShadowViewMutationList();
+
+  /*
+   * Encodes the given list; `ShadowView`s are moved into the table.
+   */
+  explicit CompactShadowViewMutationList(ShadowViewMutationList &&mutations);
+
+  void reserve(size_t mutationCount);
+
+  /*
+   * Releases memory which is only needed while the list is being built
+   * (the deduplication index and unused capacity of the tables).
+   * Mutations appended afterwards are still valid but do not share
+   * `ShadowView`s with the ones appended before.
+   */
+  void shrinkToFit();
+
+  /*
+   * Appends a mutation to the end of the list.
+   */
+  void push_back(ShadowViewMutation const &mutation);
+  void push_back(ShadowViewMutation &&mutation);
+
+  size_t size() const;
+  bool empty() const;
+
+  /*
+   * Returns the compact representation of the mutation at `index`.
+   */
+  CompactShadowViewMutation const &getCompactMutation(size_t index) const;
+
+  /*
+   * Returns the `ShadowView` stored at the given offset of the table.
+   */
+  ShadowView const &getShadowView(ShadowViewIndex index) const;
+
+  /*
+   * Returns the number of distinct `ShadowView`s in the table (including the
+   * empty one).
+   */
+  size_t getShadowViewCount() const;
+
+  /*
+   * Equivalent of `ShadowViewMutation::mutatedViewIsVirtual()` for the
+   * mutation at `index`; does not decode the mutation.
+   */
+  bool mutatedViewIsVirtual(size_t index) const;
+
+  /*
+   * Decodes the mutation at `index`.
+   */
+  ShadowViewMutation getMutation(size_t index) const;
+
+  ConstIterator begin() const;
+  ConstIterator end() const;
+
+  /*
+   * Decodes the whole list.
+   */
+  ShadowViewMutationList toList() const;
+
+ private:
+  template <typename ShadowViewT>
+  ShadowViewIndex intern(ShadowViewT &&shadowView);
+
+  template <typename ShadowViewMutationT>
+  void append(ShadowViewMutationT &&mutation);
+
+  std::vector<CompactShadowViewMutation> mutations_{};
+  std::vector<ShadowView> shadowViews_{};
+
+  /*
+   * Maps hashes of stored `ShadowView`s to their offsets in the table.
+   * Only used to deduplicate views while the list is being built; released
+   * by `shrinkToFit()`.
+   */
+  std::unordered_multimap<size_t, ShadowViewIndex> shadowViewIndices_{};
+};
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "DiffArena.h"
+
+#include <algorithm>
+
+#include <react/debug/react_native_assert.h>
+#include <react/renderer/mounting/DiffWorkPool.h>
+
+namespace facebook {
+namespace react {
+
+static inline size_t alignOffset(size_t offset, size_t alignment) {
+  return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+DiffArena::DiffArena(size_t regionCount, size_t chunkSize)
+    : chunkSize_(chunkSize), regions_(std::max(regionCount, size_t{1})) {}
+
+void *DiffArena::allocate(size_t size, size_t alignment) {
+  auto regionIndex = DiffWorkPool::getCurrentThreadIndex();
+  react_native_assert(regionIndex < regions_.size());
+  react_native_assert(alignment <= alignof(std::max_align_t));
+
+  auto &region = regions_[regionIndex];
+
+  while (region.chunkIndex < region.chunks.size()) {
+    auto &chunk = region.chunks[region.chunkIndex];
+    auto offset = alignOffset(region.offset, alignment);
+    if (offset + size <= chunk.size) {
+      region.offset = offset + size;
+      return chunk.data.get() + offset;
+    }
+
+    region.chunkIndex++;
+    region.offset = 0;
+  }
+
+  // All chunks are exhausted; growing the region.
+  auto chunkSize = std::max(chunkSize_, size);
+  region.chunks.push_back(
+      Chunk{std::unique_ptr<std::byte[]>(new std::byte[chunkSize]), chunkSize});
+  region.chunkIndex = region.chunks.size() - 1;
+  region.offset = size;
+  return region.chunks.back().data.get();
+}
+
+void DiffArena::reset() noexcept {
+  for (auto &region : regions_) {
+    // Keeping only the chunks that the last diff needed.
+    auto usedChunkCount = std::min(region.chunkIndex + 1, region.chunks.size());
+    region.chunks.resize(usedChunkCount);
+    region.chunkIndex = 0;
+    region.offset = 0;
+  }
+}
+
+size_t DiffArena::getRegionCount() const noexcept {
+  return regions_.size();
+}
+
+size_t DiffArena::getCapacity() const noexcept {
+  auto capacity = size_t{0};
+  for (auto const &region : regions_) {
+    for (auto const &chunk : region.chunks) {
+      capacity += chunk.size;
+    }
+  }
+  return capacity;
+}
+
+} // namespace react
+} // namespace facebook
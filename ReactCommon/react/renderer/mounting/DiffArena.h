@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+/*
+ * A bump allocator that owns all temporary data structures of a single
+ * `calculateShadowViewMutations` call (view-node-pair scopes, pair lists,
+ * tag maps and intermediate mutation lists).
+ *
+ * Individual deallocations are no-ops; the memory is reclaimed all at once by
+ * `reset()`, which rewinds the arena but keeps the chunks used by the last
+ * diff, so a steady-state diff of a similar size does not allocate at all.
+ *
+ * The arena has one region per thread of the `DiffWorkPool` used for the
+ * diff (see `DiffWorkPool::getCurrentThreadIndex()`); every region is used by
+ * exactly one thread, so allocation does not require synchronization.
+ * `reset()` must not be called concurrently with a diff using the arena.
+ */
+class DiffArena final {
+ public:
+  constexpr static size_t kDefaultChunkSize = 64 * 1024;
+
+  explicit DiffArena(
+      size_t regionCount = 1,
+      size_t chunkSize = kDefaultChunkSize);
+
+  /*
+   * Not copyable, not movable.
+   */
+  DiffArena(DiffArena const &) = delete;
+  DiffArena &operator=(DiffArena const &) = delete;
+
+  /*
+   * Returns a pointer to `size` bytes aligned to `alignment` from the region
+   * of the calling thread.
+   */
+  void *allocate(size_t size, size_t alignment);
+
+  /*
+   * Makes all memory allocated so far available for reuse. Chunks that were
+   * not needed by the last diff are released.
+   */
+  void reset() noexcept;
+
+  /*
+   * Returns the number of regions (the number of threads that can allocate
+   * from the arena concurrently).
+   */
+  size_t getRegionCount() const noexcept;
+
+  /*
+   * Returns the total amount of memory (in bytes) owned by the arena.
+   */
+  size_t getCapacity() const noexcept;
+
+ private:
+  struct Chunk {
+    std::unique_ptr<std::byte[]> data;
+    size_t size;
+  };
+
+  struct Region {
+    std::vector<Chunk> chunks{};
+    size_t chunkIndex{0};
+    size_t offset{0};
+  };
+
+  size_t const chunkSize_;
+  std::vector<Region> regions_;
+};
+
+/*
+ * Standard-library-compatible allocator backed by `DiffArena`.
+ * A default-constructed allocator (without an arena) falls back to the
+ * regular heap, so all differ data structures work without an arena as well.
+ */
+template <typename T>
+class DiffArenaAllocator {
+ public:
+  using value_type = T;
+
+  DiffArenaAllocator() noexcept = default;
+
+  explicit DiffArenaAllocator(DiffArena *arena) noexcept : arena_(arena) {}
+
+  template <typename U>
+  DiffArenaAllocator(DiffArenaAllocator<U> const &other) noexcept
+      : arena_(other.getArena()) {}
+
+  T *allocate(size_t count) {
+    if (arena_ == nullptr) {
+      return std::allocator<T>{}.allocate(count);
+    }
+    return static_cast<T *>(arena_->allocate(count * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T *pointer, size_t count) noexcept {
+    if (arena_ == nullptr) {
+      std::allocator<T>{}.deallocate(pointer, count);
+    }
+  }
+
+  DiffArena *getArena() const noexcept {
+    return arena_;
+  }
+
+  template <typename U>
+  bool operator==(DiffArenaAllocator<U> const &rhs) const noexcept {
+    return arena_ == rhs.getArena();
+  }
+
+  template <typename U>
+  bool operator!=(DiffArenaAllocator<U> const &rhs) const noexcept {
+    return arena_ != rhs.getArena();
+  }
+
+ private:
+  DiffArena *arena_{nullptr};
+};
+
+/*
+ * Vector of trivially copyable values with inline storage for `N` values.
+ * Once the inline storage is exhausted, the values are moved to storage
+ * allocated with `DiffArenaAllocator`, i.e. from the arena (if any) or from
+ * the heap. So, short lists (the vast majority) do not allocate at all, with
+ * or without an arena.
+ * Implements only the subset of `std::vector` interface the differ needs.
+ */
+template <typename T, size_t N>
+class DiffArenaSmallVector final {
+  static_assert(
+      std::is_trivially_copyable<T>::value,
+      "`DiffArenaSmallVector` only supports trivially copyable values.");
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using iterator = T *;
+  using const_iterator = T const *;
+  using allocator_type = DiffArenaAllocator<T>;
+
+  DiffArenaSmallVector() noexcept = default;
+
+  explicit DiffArenaSmallVector(allocator_type const &allocator) noexcept
+      : allocator_(allocator) {}
+
+  DiffArenaSmallVector(DiffArenaSmallVector const &other)
+      : allocator_(other.allocator_) {
+    reserve(other.size_);
+    copyValues(other.data_, other.size_);
+  }
+
+  DiffArenaSmallVector(DiffArenaSmallVector &&other) noexcept
+      : allocator_(other.allocator_) {
+    takeValues(other);
+  }
+
+  DiffArenaSmallVector &operator=(DiffArenaSmallVector const &other) {
+    if (this != &other) {
+      size_ = 0;
+      reserve(other.size_);
+      copyValues(other.data_, other.size_);
+    }
+    return *this;
+  }
+
+  DiffArenaSmallVector &operator=(DiffArenaSmallVector &&other) noexcept {
+    if (this != &other) {
+      deallocate();
+      allocator_ = other.allocator_;
+      takeValues(other);
+    }
+    return *this;
+  }
+
+  ~DiffArenaSmallVector() {
+    deallocate();
+  }
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_;
+  }
+
+  size_type size() const noexcept {
+    return size_;
+  }
+
+  bool empty() const noexcept {
+    return size_ == 0;
+  }
+
+  T &operator[](size_type index) noexcept {
+    return data_[index];
+  }
+
+  T const &operator[](size_type index) const noexcept {
+    return data_[index];
+  }
+
+  T &back() noexcept {
+    return data_[size_ - 1];
+  }
+
+  T const &back() const noexcept {
+    return data_[size_ - 1];
+  }
+
+  iterator begin() noexcept {
+    return data_;
+  }
+
+  iterator end() noexcept {
+    return data_ + size_;
+  }
+
+  const_iterator begin() const noexcept {
+    return data_;
+  }
+
+  const_iterator end() const noexcept {
+    return data_ + size_;
+  }
+
+  void reserve(size_type capacity) {
+    if (capacity <= capacity_) {
+      return;
+    }
+
+    auto data = allocator_.allocate(capacity);
+    std::memcpy(data, data_, size_ * sizeof(T));
+    deallocate();
+    data_ = data;
+    capacity_ = capacity;
+  }
+
+  void push_back(T const &value) {
+    if (size_ == capacity_) {
+      // `value` might refer to an element of the vector itself.
+      auto copy = value;
+      reserve(capacity_ * 2);
+      data_[size_++] = copy;
+      return;
+    }
+    data_[size_++] = value;
+  }
+
+  void clear() noexcept {
+    size_ = 0;
+  }
+
+ private:
+  bool isInline() const noexcept {
+    return data_ == inlineValues_;
+  }
+
+  void deallocate() noexcept {
+    if (!isInline()) {
+      allocator_.deallocate(data_, capacity_);
+    }
+  }
+
+  void copyValues(T const *values, size_type size) noexcept {
+    std::memcpy(data_, values, size * sizeof(T));
+    size_ = size;
+  }
+
+  /*
+   * Takes values of `other` (which must use the same allocator) leaving it
+   * empty. Inline values are copied, allocated storage is taken over.
+   */
+  void takeValues(DiffArenaSmallVector &other) noexcept {
+    if (other.isInline()) {
+      data_ = inlineValues_;
+      capacity_ = N;
+      copyValues(other.data_, other.size_);
+    } else {
+      data_ = other.data_;
+      capacity_ = other.capacity_;
+      size_ = other.size_;
+    }
+
+    other.data_ = other.inlineValues_;
+    other.capacity_ = N;
+    other.size_ = 0;
+  }
+
+  allocator_type allocator_{};
+  T inlineValues_[N];
+  T *data_{inlineValues_};
+  size_type size_{0};
+  size_type capacity_{N};
+};
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "DiffWorkPool.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace facebook {
+namespace react {
+
+static thread_local size_t currentThreadIndex = 0;
+
+struct DiffWorkPool::Batch final {
+  Batch(size_t count, std::function<void(size_t index)> const &body)
+      : count(count), body(body) {}
+
+  size_t const count;
+  std::function<void(size_t index)> const &body;
+
+  std::atomic<size_t> nextIndex{0};
+  std::atomic<size_t> finishedCount{0};
+
+  std::mutex mutex;
+  std::condition_variable signal;
+
+  /*
+   * Claims and executes a single item of the batch.
+   * Returns `false` if all items were already claimed.
+   */
+  bool runNextItem() {
+    auto index = nextIndex.fetch_add(1);
+    if (index >= count) {
+      return false;
+    }
+
+    body(index);
+
+    if (finishedCount.fetch_add(1) + 1 == count) {
+      std::lock_guard<std::mutex> lock(mutex);
+      signal.notify_all();
+    }
+    return true;
+  }
+};
+
+DiffWorkPool::DiffWorkPool(size_t concurrency) {
+  auto threadCount = concurrency > 1 ? concurrency - 1 : 0;
+  threads_.reserve(threadCount);
+  for (size_t i = 0; i < threadCount; i++) {
+    threads_.emplace_back([this, i]() { workerLoop(i + 1); });
+  }
+}
+
+DiffWorkPool::~DiffWorkPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isStopping_ = true;
+  }
+  signal_.notify_all();
+
+  for (auto &thread : threads_) {
+    thread.join();
+  }
+}
+
+size_t DiffWorkPool::getConcurrency() const noexcept {
+  return threads_.size() + 1;
+}
+
+size_t DiffWorkPool::getCurrentThreadIndex() noexcept {
+  return currentThreadIndex;
+}
+
+void DiffWorkPool::parallelFor(
+    size_t count,
+    std::function<void(size_t index)> const &body) const {
+  if (threads_.empty() || count < 2) {
+    for (size_t index = 0; index < count; index++) {
+      body(index);
+    }
+    return;
+  }
+
+  auto batch = std::make_shared<Batch>(count, body);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    batches_.push_back(batch);
+  }
+  signal_.notify_all();
+
+  // The calling thread works on its own batch until all items are claimed.
+  while (batch->runNextItem()) {
+  }
+
+  retireBatch(batch);
+
+  // Some items might still be executed by workers; wait for them.
+  std::unique_lock<std::mutex> lock(batch->mutex);
+  batch->signal.wait(
+      lock, [&]() { return batch->finishedCount.load() == batch->count; });
+}
+
+#pragma mark - Private
+
+void DiffWorkPool::retireBatch(std::shared_ptr<Batch> const &batch) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iterator = std::find(batches_.begin(), batches_.end(), batch);
+  if (iterator != batches_.end()) {
+    batches_.erase(iterator);
+  }
+}
+
+void DiffWorkPool::workerLoop(size_t threadIndex) const {
+  currentThreadIndex = threadIndex;
+
+  while (true) {
+    auto batch = std::shared_ptr<Batch>{};
+
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      signal_.wait(lock, [this]() { return isStopping_ || !batches_.empty(); });
+
+      if (isStopping_) {
+        return;
+      }
+
+      // Steal from the most recently published (usually the deepest) batch.
+      batch = batches_.back();
+    }
+
+    if (!batch->runNextItem()) {
+      retireBatch(batch);
+    }
+  }
+}
+
+} // namespace react
+} // namespace facebook
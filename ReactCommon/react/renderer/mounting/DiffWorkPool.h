@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+/*
+ * A small pool of worker threads used by the differentiator to diff
+ * independent subtrees concurrently.
+ *
+ * Work is submitted as batches of indexed items (see `parallelFor`). The
+ * submitting thread always participates in executing its own batch, and idle
+ * workers steal unclaimed items from the most recently published batch first.
+ * Because a thread never waits for an item that nobody is executing, nested
+ * `parallelFor` calls (from inside an item) are safe and cannot deadlock.
+ *
+ * The pool is thread-safe and can be shared between surfaces.
+ */
+class DiffWorkPool final {
+ public:
+  using Shared = std::shared_ptr<DiffWorkPool const>;
+
+  /*
+   * Creates a pool that executes work on `concurrency` threads in total,
+   * including the calling thread. A value of `1` (or less) makes the pool
+   * serial: no threads are spawned and `parallelFor` runs inline.
+   */
+  explicit DiffWorkPool(
+      size_t concurrency = std::thread::hardware_concurrency());
+
+  /*
+   * Not copyable, not movable.
+   */
+  DiffWorkPool(DiffWorkPool const &) = delete;
+  DiffWorkPool &operator=(DiffWorkPool const &) = delete;
+
+  ~DiffWorkPool();
+
+  /*
+   * Returns the number of threads (including the calling one) that can execute
+   * work submitted to the pool.
+   */
+  size_t getConcurrency() const noexcept;
+
+  /*
+   * Returns the index of the calling thread within the pool it belongs to:
+   * `0` for any thread which is not a worker of a pool (e.g. the thread that
+   * calls `parallelFor`), and `1...getConcurrency() - 1` for workers.
+   * Can be used to address per-thread storage without synchronization.
+   */
+  static size_t getCurrentThreadIndex() noexcept;
+
+  /*
+   * Calls `body` for every index in `[0, count)`, possibly concurrently, and
+   * returns when all of them have finished. The order of invocations is
+   * unspecified; callers must write results into index-addressed storage.
+   * `body` must not throw.
+   */
+  void parallelFor(size_t count, std::function<void(size_t index)> const &body)
+      const;
+
+ private:
+  struct Batch;
+
+  void workerLoop(size_t threadIndex) const;
+  void retireBatch(std::shared_ptr<Batch> const &batch) const;
+
+  std::vector<std::thread> threads_;
+
+  mutable std::mutex mutex_;
+  mutable std::condition_variable signal_;
+  mutable std::vector<std::shared_ptr<Batch>> batches_; // Protected by `mutex_`.
+  mutable bool isStopping_{false}; // Protected by `mutex_`.
+};
+
+} // namespace react
+} // namespace facebook
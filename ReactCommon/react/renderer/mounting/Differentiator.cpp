@@ -54,10 +54,10 @@ namespace react {
  *
  * In our particular case, we need a map for `int` to `void *` with a dozen
  * values. In these conditions, nothing can beat a naive implementation using a
- * stack-allocated vector. And this implementation is exactly this: no
- * allocation, no hashing, no complex branching, no buckets, no iterators, no
- * rehashing, no other guarantees. It's crazy limited, unsafe, and performant on
- * a trivial amount of data.
+ * vector allocated from the diff's arena. And this implementation is exactly
+ * this: no heap allocation, no hashing, no complex branching, no buckets, no
+ * iterators, no rehashing, no other guarantees. It's crazy limited, unsafe, and
+ * performant on a trivial amount of data.
  *
  * Besides that, we also need to optimize for insertion performance (the case
  * where a bunch of views appears on the screen first time); in this
@@ -69,6 +69,9 @@ class TinyMap final {
   using Pair = std::pair<KeyT, ValueT>;
   using Iterator = Pair *;
 
+  explicit TinyMap(DiffArenaAllocator<Pair> const &allocator)
+      : vector_(allocator) {}
+
   /**
    * This must strictly only be called from outside of this class.
    */
@@ -116,6 +119,9 @@ class TinyMap final {
 
   inline void insert(Pair pair) {
     react_native_assert(pair.first != 0);
+    if (vector_.capacity() == 0) {
+      vector_.reserve(DefaultSize);
+    }
     vector_.push_back(pair);
   }
 
@@ -168,7 +174,7 @@ class TinyMap final {
     erasedAtFront_ = 0;
   }
 
-  butter::small_vector<Pair, DefaultSize> vector_;
+  std::vector<Pair, DiffArenaAllocator<Pair>> vector_;
   size_t numErased_{0};
   size_t erasedAtFront_{0};
 };
@@ -245,7 +251,7 @@ static void sliceChildShadowNodeViewPairsRecursivelyV2(
       storedOrigin = origin;
     }
     scope.push_back(
-        {shadowView,
+        {std::move(shadowView),
          &childShadowNode,
          areChildrenFlattened,
          isConcreteView,
@@ -264,7 +270,7 @@ ShadowViewNodePair::NonOwningList sliceChildShadowNodeViewPairsV2(
     ViewNodePairScope &scope,
     bool allowFlattened,
     Point layoutOffset) {
-  auto pairList = ShadowViewNodePair::NonOwningList{};
+  auto pairList = ShadowViewNodePair::NonOwningList(scope.get_allocator());
 
   if (!shadowNode.getTraits().check(
           ShadowNodeTraits::Trait::FormsStackingContext) &&
@@ -335,27 +341,47 @@ static_assert(
     std::is_move_assignable<ShadowViewNodePair::NonOwningList>::value,
     "`ShadowViewNodePair::NonOwningList` must be `move assignable`.");
 
+/*
+ * Intermediate list of mutations; allocated from the diff's arena (if any).
+ * Only the final list returned by `calculateShadowViewMutations` is
+ * allocated on the regular heap.
+ */
+using MutationList =
+    std::vector<ShadowViewMutation, DiffArenaAllocator<ShadowViewMutation>>;
+
 static void calculateShadowViewMutationsV2(
     BREADCRUMB_TYPE breadcrumb,
     ViewNodePairScope &scope,
-    ShadowViewMutation::List &mutations,
+    DiffWorkPool const *workPool,
+    MutationList &mutations,
     ShadowView const &parentShadowView,
     ShadowViewNodePair::NonOwningList &&oldChildPairs,
     ShadowViewNodePair::NonOwningList &&newChildPairs);
 
 struct OrderedMutationInstructionContainer {
-  ShadowViewMutation::List createMutations{};
-  ShadowViewMutation::List deleteMutations{};
-  ShadowViewMutation::List insertMutations{};
-  ShadowViewMutation::List removeMutations{};
-  ShadowViewMutation::List updateMutations{};
-  ShadowViewMutation::List downwardMutations{};
-  ShadowViewMutation::List destructiveDownwardMutations{};
+  explicit OrderedMutationInstructionContainer(
+      DiffArenaAllocator<ShadowViewMutation> const &allocator)
+      : createMutations(allocator),
+        deleteMutations(allocator),
+        insertMutations(allocator),
+        removeMutations(allocator),
+        updateMutations(allocator),
+        downwardMutations(allocator),
+        destructiveDownwardMutations(allocator) {}
+
+  MutationList createMutations;
+  MutationList deleteMutations;
+  MutationList insertMutations;
+  MutationList removeMutations;
+  MutationList updateMutations;
+  MutationList downwardMutations;
+  MutationList destructiveDownwardMutations;
 };
 
 static void updateMatchedPairSubtrees(
     BREADCRUMB_TYPE breadcrumb,
     ViewNodePairScope &scope,
+    DiffWorkPool const *workPool,
     OrderedMutationInstructionContainer &mutationContainer,
     TinyMap<Tag, ShadowViewNodePair *> &newRemainingPairs,
     ShadowViewNodePair::NonOwningList &oldChildPairs,
@@ -364,6 +390,102 @@ static void updateMatchedPairSubtrees(
     ShadowViewNodePair const &oldPair,
     ShadowViewNodePair const &newPair);
 
+/*
+ * List of matched old/new pairs (with the same tag and flattening status)
+ * whose subtrees must be diffed.
+ */
+using MatchedSubtreePairList = butter::small_vector<
+    std::pair<ShadowViewNodePair const *, ShadowViewNodePair const *>,
+    kShadowNodeChildrenSmallVectorSize>;
+
+/*
+ * Diffs the subtrees of all pairs matched during Stage 1, appending the
+ * results to `downwardMutations` (or `destructiveDownwardMutations` if the
+ * new subtree is empty) in the order of `matchedSubtreePairs`.
+ *
+ * Every subtree is diffed within its own `ViewNodePairScope` and only reads
+ * immutable `ShadowNode`s, so the subtrees are independent from each other.
+ * When a `DiffWorkPool` is provided, they are diffed concurrently and the
+ * per-subtree results are merged afterwards in exactly the order the serial
+ * algorithm would have produced.
+ */
+static void calculateShadowViewMutationsForMatchedSubtrees(
+    BREADCRUMB_TYPE breadcrumb,
+    ViewNodePairScope &scope,
+    DiffWorkPool const *workPool,
+    OrderedMutationInstructionContainer &mutationContainer,
+    MatchedSubtreePairList const &matchedSubtreePairs) {
+  if (workPool == nullptr || workPool->getConcurrency() < 2 ||
+      matchedSubtreePairs.size() < 2) {
+    for (auto const &matchedSubtreePair : matchedSubtreePairs) {
+      auto const &oldPair = *matchedSubtreePair.first;
+      auto const &newPair = *matchedSubtreePair.second;
+
+      ViewNodePairScope innerScope{scope.get_allocator()};
+      auto oldGrandChildPairs =
+          sliceChildShadowNodeViewPairsFromViewNodePair(oldPair, innerScope);
+      auto newGrandChildPairs =
+          sliceChildShadowNodeViewPairsFromViewNodePair(newPair, innerScope);
+      calculateShadowViewMutationsV2(
+          DIFF_BREADCRUMB(
+              "Stage 1: Recurse on " + std::to_string(oldPair.shadowView.tag)),
+          innerScope,
+          workPool,
+          *(newGrandChildPairs.size()
+                ? &mutationContainer.downwardMutations
+                : &mutationContainer.destructiveDownwardMutations),
+          oldPair.shadowView,
+          std::move(oldGrandChildPairs),
+          std::move(newGrandChildPairs));
+    }
+    return;
+  }
+
+  struct SubtreeMutations {
+    MutationList mutations;
+    bool isDestructive{false};
+  };
+
+  auto subtreeMutations = std::vector<SubtreeMutations>{};
+  subtreeMutations.reserve(matchedSubtreePairs.size());
+  for (size_t i = 0; i < matchedSubtreePairs.size(); i++) {
+    subtreeMutations.push_back(
+        SubtreeMutations{MutationList(scope.get_allocator())});
+  }
+
+  workPool->parallelFor(matchedSubtreePairs.size(), [&](size_t index) {
+    auto const &oldPair = *matchedSubtreePairs[index].first;
+    auto const &newPair = *matchedSubtreePairs[index].second;
+    auto &result = subtreeMutations[index];
+
+    ViewNodePairScope innerScope{scope.get_allocator()};
+    auto oldGrandChildPairs =
+        sliceChildShadowNodeViewPairsFromViewNodePair(oldPair, innerScope);
+    auto newGrandChildPairs =
+        sliceChildShadowNodeViewPairsFromViewNodePair(newPair, innerScope);
+    result.isDestructive = newGrandChildPairs.empty();
+    calculateShadowViewMutationsV2(
+        DIFF_BREADCRUMB(
+            "Stage 1: Recurse on " + std::to_string(oldPair.shadowView.tag)),
+        innerScope,
+        workPool,
+        result.mutations,
+        oldPair.shadowView,
+        std::move(oldGrandChildPairs),
+        std::move(newGrandChildPairs));
+  });
+
+  for (auto &result : subtreeMutations) {
+    auto &mutations =
+        (result.isDestructive ? mutationContainer.destructiveDownwardMutations
+                              : mutationContainer.downwardMutations);
+    std::move(
+        result.mutations.begin(),
+        result.mutations.end(),
+        std::back_inserter(mutations));
+  }
+}
+
 static void updateMatchedPair(
     BREADCRUMB_TYPE breadcrumb,
     OrderedMutationInstructionContainer &mutationContainer,
@@ -376,6 +498,7 @@ static void updateMatchedPair(
 static void calculateShadowViewMutationsFlattener(
     BREADCRUMB_TYPE breadcrumb,
     ViewNodePairScope &scope,
+    DiffWorkPool const *workPool,
     ReparentMode reparentMode,
     OrderedMutationInstructionContainer &mutationContainer,
     ShadowView const &parentShadowView,
@@ -396,6 +519,7 @@ static void calculateShadowViewMutationsFlattener(
 static void updateMatchedPairSubtrees(
     BREADCRUMB_TYPE breadcrumb,
     ViewNodePairScope &scope,
+    DiffWorkPool const *workPool,
     OrderedMutationInstructionContainer &mutationContainer,
     TinyMap<Tag, ShadowViewNodePair *> &newRemainingPairs,
     ShadowViewNodePair::NonOwningList &oldChildPairs,
@@ -430,6 +554,7 @@ static void updateMatchedPairSubtrees(
               "Flatten tree " + std::to_string(parentShadowView.tag) +
               " into list " + std::to_string(oldPair.shadowView.tag)),
           scope,
+          workPool,
           ReparentMode::Flatten,
           mutationContainer,
           parentShadowView,
@@ -439,7 +564,8 @@ static void updateMatchedPairSubtrees(
     // Unflattening
     else {
       // Construct unvisited nodes map
-      auto unvisitedOldChildPairs = TinyMap<Tag, ShadowViewNodePair *>{};
+      auto unvisitedOldChildPairs =
+          TinyMap<Tag, ShadowViewNodePair *>{scope.get_allocator()};
       // We don't know where all the children of oldChildPair are
       // within oldChildPairs, but we know that they're in the same
       // relative order. The reason for this is because of flattening
@@ -463,6 +589,7 @@ static void updateMatchedPairSubtrees(
               "Unflatten old list " + std::to_string(parentShadowView.tag) +
               " into new tree " + std::to_string(newPair.shadowView.tag)),
           scope,
+          workPool,
           ReparentMode::Unflatten,
           mutationContainer,
           parentShadowView,
@@ -492,10 +619,11 @@ static void updateMatchedPairSubtrees(
     return;
   }
 
-  // Update subtrees if View is not flattened, and if node addresses
-  // are not equal
-  if (oldPair.shadowNode != newPair.shadowNode) {
-    ViewNodePairScope innerScope{};
+  // Update subtrees if View is not flattened, and if the subtrees are not
+  // mount-equivalent (e.g. node addresses are not equal)
+  if (!ShadowNode::areSubtreesMountEquivalent(
+          *oldPair.shadowNode, *newPair.shadowNode)) {
+    ViewNodePairScope innerScope{scope.get_allocator()};
     auto oldGrandChildPairs =
         sliceChildShadowNodeViewPairsFromViewNodePair(oldPair, innerScope);
     auto newGrandChildPairs =
@@ -504,6 +632,7 @@ static void updateMatchedPairSubtrees(
         DIFF_BREADCRUMB(
             "Non-trivial update " + std::to_string(oldPair.shadowView.tag)),
         innerScope,
+        workPool,
         *(newGrandChildPairs.size()
               ? &mutationContainer.downwardMutations
               : &mutationContainer.destructiveDownwardMutations),
@@ -619,6 +748,7 @@ static void updateMatchedPair(
 static void calculateShadowViewMutationsFlattener(
     BREADCRUMB_TYPE breadcrumb,
     ViewNodePairScope &scope,
+    DiffWorkPool const *workPool,
     ReparentMode reparentMode,
     OrderedMutationInstructionContainer &mutationContainer,
     ShadowView const &parentShadowView,
@@ -666,8 +796,10 @@ static void calculateShadowViewMutationsFlattener(
 
   // Views in other tree that are visited by sub-flattening or
   // sub-unflattening
-  TinyMap<Tag, ShadowViewNodePair *> subVisitedOtherNewNodes{};
-  TinyMap<Tag, ShadowViewNodePair *> subVisitedOtherOldNodes{};
+  TinyMap<Tag, ShadowViewNodePair *> subVisitedOtherNewNodes{
+      scope.get_allocator()};
+  TinyMap<Tag, ShadowViewNodePair *> subVisitedOtherOldNodes{
+      scope.get_allocator()};
   auto subVisitedNewMap =
       (parentSubVisitedOtherNewNodes != nullptr ? parentSubVisitedOtherNewNodes
                                                 : &subVisitedOtherNewNodes);
@@ -677,7 +809,7 @@ static void calculateShadowViewMutationsFlattener(
 
   // Candidates for full tree creation or deletion at the end of this function
   auto deletionCreationCandidatePairs =
-      TinyMap<Tag, ShadowViewNodePair const *>{};
+      TinyMap<Tag, ShadowViewNodePair const *>{scope.get_allocator()};
 
   for (size_t index = 0;
        index < treeChildren.size() && index < treeChildren.size();
@@ -839,13 +971,15 @@ static void calculateShadowViewMutationsFlattener(
 
       // Update children if appropriate.
       if (!oldTreeNodePair.flattened && !newTreeNodePair.flattened) {
-        if (oldTreeNodePair.shadowNode != newTreeNodePair.shadowNode) {
-          ViewNodePairScope innerScope{};
+        if (!ShadowNode::areSubtreesMountEquivalent(
+                *oldTreeNodePair.shadowNode, *newTreeNodePair.shadowNode)) {
+          ViewNodePairScope innerScope{scope.get_allocator()};
           calculateShadowViewMutationsV2(
               DIFF_BREADCRUMB(
                   "(Un)Flattener trivial update of " +
                   std::to_string(newTreeNodePair.shadowView.tag)),
               innerScope,
+              workPool,
               mutationContainer.downwardMutations,
               newTreeNodePair.shadowView,
               sliceChildShadowNodeViewPairsFromViewNodePair(
@@ -876,6 +1010,7 @@ static void calculateShadowViewMutationsFlattener(
                           : newTreeNodePair.shadowView.tag) +
                   " old:" + std::to_string(treeChildPair.shadowView.tag)),
               scope,
+              workPool,
               childReparentMode,
               mutationContainer,
               (reparentMode == ReparentMode::Flatten
@@ -894,7 +1029,7 @@ static void calculateShadowViewMutationsFlattener(
               true);
           // Construct unvisited nodes map
           auto unvisitedRecursiveChildPairs =
-              TinyMap<Tag, ShadowViewNodePair *>{};
+              TinyMap<Tag, ShadowViewNodePair *>{scope.get_allocator()};
           for (auto &flattenedNode : flattenedNodes) {
             auto &newChild = *flattenedNode;
 
@@ -924,6 +1059,7 @@ static void calculateShadowViewMutationsFlattener(
                             : newTreeNodePair.shadowView.tag) +
                     " old:" + std::to_string(oldTreeNodePair.shadowView.tag)),
                 scope,
+                workPool,
                 ReparentMode::Flatten,
                 mutationContainer,
                 (reparentMode == ReparentMode::Flatten
@@ -946,6 +1082,7 @@ static void calculateShadowViewMutationsFlattener(
                             : newTreeNodePair.shadowView.tag) +
                     " new:" + std::to_string(newTreeNodePair.shadowView.tag)),
                 scope,
+                workPool,
                 ReparentMode::Unflatten,
                 mutationContainer,
                 (reparentMode == ReparentMode::Flatten
@@ -1044,12 +1181,13 @@ static void calculateShadowViewMutationsFlattener(
           ShadowViewMutation::DeleteMutation(treeChildPair.shadowView));
 
       if (!treeChildPair.flattened) {
-        ViewNodePairScope innerScope{};
+        ViewNodePairScope innerScope{scope.get_allocator()};
         calculateShadowViewMutationsV2(
             DIFF_BREADCRUMB(
                 "Recursively delete tree child pair (flatten case): " +
                 std::to_string(treeChildPair.shadowView.tag)),
             innerScope,
+            workPool,
             mutationContainer.destructiveDownwardMutations,
             treeChildPair.shadowView,
             sliceChildShadowNodeViewPairsFromViewNodePair(
@@ -1061,12 +1199,13 @@ static void calculateShadowViewMutationsFlattener(
           ShadowViewMutation::CreateMutation(treeChildPair.shadowView));
 
       if (!treeChildPair.flattened) {
-        ViewNodePairScope innerScope{};
+        ViewNodePairScope innerScope{scope.get_allocator()};
         calculateShadowViewMutationsV2(
             DIFF_BREADCRUMB(
                 "Recursively delete tree child pair (unflatten case): " +
                 std::to_string(treeChildPair.shadowView.tag)),
             innerScope,
+            workPool,
             mutationContainer.downwardMutations,
             treeChildPair.shadowView,
             {},
@@ -1080,7 +1219,8 @@ static void calculateShadowViewMutationsFlattener(
 static void calculateShadowViewMutationsV2(
     BREADCRUMB_TYPE breadcrumb,
     ViewNodePairScope &scope,
-    ShadowViewMutation::List &mutations,
+    DiffWorkPool const *workPool,
+    MutationList &mutations,
     ShadowView const &parentShadowView,
     ShadowViewNodePair::NonOwningList &&oldChildPairs,
     ShadowViewNodePair::NonOwningList &&newChildPairs) {
@@ -1091,7 +1231,8 @@ static void calculateShadowViewMutationsV2(
   size_t index = 0;
 
   // Lists of mutations
-  auto mutationContainer = OrderedMutationInstructionContainer{};
+  auto mutationContainer =
+      OrderedMutationInstructionContainer{scope.get_allocator()};
 
   DEBUG_LOGS({
     LOG(ERROR) << "Differ Entry: Child Pairs of node: [" << parentShadowView.tag
@@ -1119,6 +1260,7 @@ static void calculateShadowViewMutationsV2(
   });
 
   // Stage 1: Collecting `Update` mutations
+  auto matchedSubtreePairs = MatchedSubtreePairList{};
   for (index = 0; index < oldChildPairs.size() && index < newChildPairs.size();
        index++) {
     auto &oldChildPair = *oldChildPairs[index];
@@ -1161,28 +1303,22 @@ static void calculateShadowViewMutationsV2(
               oldChildPair.shadowView, newChildPair.shadowView));
     }
 
-    // Recursively update tree if ShadowNode pointers are not equal
+    // Recursively update tree if subtrees are not mount-equivalent (e.g.
+    // ShadowNode pointers are not equal)
     if (!oldChildPair.flattened &&
-        oldChildPair.shadowNode != newChildPair.shadowNode) {
-      ViewNodePairScope innerScope{};
-      auto oldGrandChildPairs = sliceChildShadowNodeViewPairsFromViewNodePair(
-          oldChildPair, innerScope);
-      auto newGrandChildPairs = sliceChildShadowNodeViewPairsFromViewNodePair(
-          newChildPair, innerScope);
-      calculateShadowViewMutationsV2(
-          DIFF_BREADCRUMB(
-              "Stage 1: Recurse on " +
-              std::to_string(oldChildPair.shadowView.tag)),
-          innerScope,
-          *(newGrandChildPairs.size()
-                ? &mutationContainer.downwardMutations
-                : &mutationContainer.destructiveDownwardMutations),
-          oldChildPair.shadowView,
-          std::move(oldGrandChildPairs),
-          std::move(newGrandChildPairs));
+        !ShadowNode::areSubtreesMountEquivalent(
+            *oldChildPair.shadowNode, *newChildPair.shadowNode)) {
+      matchedSubtreePairs.push_back({&oldChildPair, &newChildPair});
     }
   }
 
+  calculateShadowViewMutationsForMatchedSubtrees(
+      DIFF_BREADCRUMB("Stage 1"),
+      scope,
+      workPool,
+      mutationContainer,
+      matchedSubtreePairs);
+
   size_t lastIndexAfterFirstStage = index;
 
   if (index == newChildPairs.size()) {
@@ -1211,11 +1347,12 @@ static void calculateShadowViewMutationsV2(
 
       // We also have to call the algorithm recursively to clean up the entire
       // subtree starting from the removed view.
-      ViewNodePairScope innerScope{};
+      ViewNodePairScope innerScope{scope.get_allocator()};
       calculateShadowViewMutationsV2(
           DIFF_BREADCRUMB(
               "Trivial delete " + std::to_string(oldChildPair.shadowView.tag)),
           innerScope,
+          workPool,
           mutationContainer.destructiveDownwardMutations,
           oldChildPair.shadowView,
           sliceChildShadowNodeViewPairsFromViewNodePair(
@@ -1246,11 +1383,12 @@ static void calculateShadowViewMutationsV2(
       mutationContainer.createMutations.push_back(
           ShadowViewMutation::CreateMutation(newChildPair.shadowView));
 
-      ViewNodePairScope innerScope{};
+      ViewNodePairScope innerScope{scope.get_allocator()};
       calculateShadowViewMutationsV2(
           DIFF_BREADCRUMB(
               "Trivial create " + std::to_string(newChildPair.shadowView.tag)),
           innerScope,
+          workPool,
           mutationContainer.downwardMutations,
           newChildPair.shadowView,
           {},
@@ -1259,9 +1397,12 @@ static void calculateShadowViewMutationsV2(
     }
   } else {
     // Collect map of tags in the new list
-    auto newRemainingPairs = TinyMap<Tag, ShadowViewNodePair *>{};
-    auto newInsertedPairs = TinyMap<Tag, ShadowViewNodePair *>{};
-    auto deletionCandidatePairs = TinyMap<Tag, ShadowViewNodePair const *>{};
+    auto newRemainingPairs =
+        TinyMap<Tag, ShadowViewNodePair *>{scope.get_allocator()};
+    auto newInsertedPairs =
+        TinyMap<Tag, ShadowViewNodePair *>{scope.get_allocator()};
+    auto deletionCandidatePairs =
+        TinyMap<Tag, ShadowViewNodePair const *>{scope.get_allocator()};
     for (; index < newChildPairs.size(); index++) {
       auto &newChildPair = *newChildPairs[index];
       newRemainingPairs.insert({newChildPair.shadowView.tag, &newChildPair});
@@ -1314,6 +1455,7 @@ static void calculateShadowViewMutationsV2(
                   "Update Matched Pair Subtrees (1): " +
                   std::to_string(oldChildPair.shadowView.tag)),
               scope,
+              workPool,
               mutationContainer,
               newRemainingPairs,
               oldChildPairs,
@@ -1359,6 +1501,7 @@ static void calculateShadowViewMutationsV2(
                   "Update Matched Pair Subtrees (2): " +
                   std::to_string(oldChildPair.shadowView.tag)),
               scope,
+              workPool,
               mutationContainer,
               newRemainingPairs,
               oldChildPairs,
@@ -1498,12 +1641,13 @@ static void calculateShadowViewMutationsV2(
 
         // We also have to call the algorithm recursively to clean up the
         // entire subtree starting from the removed view.
-        ViewNodePairScope innerScope{};
+        ViewNodePairScope innerScope{scope.get_allocator()};
         calculateShadowViewMutationsV2(
             DIFF_BREADCRUMB(
                 "Non-trivial delete " +
                 std::to_string(oldChildPair.shadowView.tag)),
             innerScope,
+            workPool,
             mutationContainer.destructiveDownwardMutations,
             oldChildPair.shadowView,
             sliceChildShadowNodeViewPairsFromViewNodePair(
@@ -1545,12 +1689,13 @@ static void calculateShadowViewMutationsV2(
       mutationContainer.createMutations.push_back(
           ShadowViewMutation::CreateMutation(newChildPair.shadowView));
 
-      ViewNodePairScope innerScope{};
+      ViewNodePairScope innerScope{scope.get_allocator()};
       calculateShadowViewMutationsV2(
           DIFF_BREADCRUMB(
               "Non-trivial create " +
               std::to_string(newChildPair.shadowView.tag)),
           innerScope,
+          workPool,
           mutationContainer.downwardMutations,
           newChildPair.shadowView,
           {},
@@ -1650,18 +1795,28 @@ ShadowViewNodePair::OwningList sliceChildShadowNodeViewPairsLegacy(
 
 ShadowViewMutation::List calculateShadowViewMutations(
     ShadowNode const &oldRootShadowNode,
-    ShadowNode const &newRootShadowNode) {
+    ShadowNode const &newRootShadowNode,
+    DiffWorkPool const *workPool,
+    DiffArena *arena) {
   SystraceSection s("calculateShadowViewMutations");
 
   // Root shadow nodes must be belong the same family.
   react_native_assert(
       ShadowNode::sameFamily(oldRootShadowNode, newRootShadowNode));
 
+  // The arena is only usable if it has a region for every thread of the pool.
+  if (arena != nullptr && workPool != nullptr &&
+      arena->getRegionCount() < workPool->getConcurrency()) {
+    arena = nullptr;
+  }
+
+  auto allocator = DiffArenaAllocator<ShadowViewNodePair>{arena};
+
   // See explanation of scope in Differentiator.h.
-  ViewNodePairScope viewNodePairScope{};
-  ViewNodePairScope innerViewNodePairScope{};
+  ViewNodePairScope viewNodePairScope{allocator};
+  ViewNodePairScope innerViewNodePairScope{allocator};
 
-  auto mutations = ShadowViewMutation::List{};
+  auto mutations = MutationList(allocator);
   mutations.reserve(256);
 
   auto oldRootShadowView = ShadowView(oldRootShadowNode);
@@ -1675,12 +1830,17 @@ ShadowViewMutation::List calculateShadowViewMutations(
   calculateShadowViewMutationsV2(
       CREATE_DIFF_BREADCRUMB(oldRootShadowView.tag),
       innerViewNodePairScope,
+      workPool,
       mutations,
       ShadowView(oldRootShadowNode),
       sliceChildShadowNodeViewPairsV2(oldRootShadowNode, viewNodePairScope),
       sliceChildShadowNodeViewPairsV2(newRootShadowNode, viewNodePairScope));
 
-  return mutations;
+  // The result outlives the diff (and the arena), so it is moved to the heap.
+  auto result = ShadowViewMutation::List{};
+  result.reserve(mutations.size());
+  std::move(mutations.begin(), mutations.end(), std::back_inserter(result));
+  return result;
 }
 
 } // namespace react
@@ -9,6 +9,8 @@
 
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/debug/flags.h>
+#include <react/renderer/mounting/DiffArena.h>
+#include <react/renderer/mounting/DiffWorkPool.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
 #include <deque>
 
@@ -37,17 +39,29 @@ enum class ReparentMode { Flatten, Unflatten };
  * both (1) ensures that pointers into the data-structure are never invalidated,
  * and (2) tries to efficiently allocate storage such that as many objects as
  * possible are close in memory, but does not guarantee adjacency.
+ *
+ * The scope allocates from the `DiffArena` of the diff (if any), so all scopes
+ * (and the lists created with their allocator) are freed at once when the
+ * arena is reset.
  */
-using ViewNodePairScope = std::deque<ShadowViewNodePair>;
+using ViewNodePairScope =
+    std::deque<ShadowViewNodePair, DiffArenaAllocator<ShadowViewNodePair>>;
 
 /*
  * Calculates a list of view mutations which describes how the old
  * `ShadowTree` can be transformed to the new one.
  * The list of mutations might be and might not be optimal.
+ * If `workPool` is provided, independent subtrees are diffed concurrently
+ * on it; the resulting list is identical to the one computed serially.
+ * If `arena` is provided, all temporary data structures of the diff are
+ * allocated from it; the caller is responsible for resetting it afterwards.
+ * The arena is ignored if it has fewer regions than `workPool` has threads.
  */
 ShadowViewMutation::List calculateShadowViewMutations(
     ShadowNode const &oldRootShadowNode,
-    ShadowNode const &newRootShadowNode);
+    ShadowNode const &newRootShadowNode,
+    DiffWorkPool const *workPool = nullptr,
+    DiffArena *arena = nullptr);
 
 /**
  * Generates a list of `ShadowViewNodePair`s that represents a layer of a
@@ -16,6 +16,7 @@
 
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
+#include <react/renderer/mounting/ShadowViewMutationCompaction.h>
 
 namespace facebook {
 namespace react {
@@ -23,6 +24,7 @@ namespace react {
 MountingCoordinator::MountingCoordinator(ShadowTreeRevision baseRevision)
     : surfaceId_(baseRevision.rootShadowNode->getSurfaceId()),
       baseRevision_(baseRevision),
+      diffArena_(std::make_unique<DiffArena>()),
       telemetryController_(*this) {
 #ifdef RN_SHADOW_TREE_INTROSPECTION
   stubViewTree_ = buildStubViewTreeWithoutUsingDifferentiator(
@@ -81,6 +83,10 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
 
   auto transaction = std::optional<MountingTransaction>{};
 
+  auto mountingOverrideDelegate = mountingOverrideDelegate_.lock();
+  auto shouldOverridePullTransaction = mountingOverrideDelegate &&
+      mountingOverrideDelegate->shouldOverridePullTransaction();
+
   // Base case
   if (lastRevision_.has_value()) {
     number_++;
@@ -90,26 +96,47 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
     telemetry.willDiff();
 
     auto mutations = calculateShadowViewMutations(
-        *baseRevision_.rootShadowNode, *lastRevision_->rootShadowNode);
+        *baseRevision_.rootShadowNode,
+        *lastRevision_->rootShadowNode,
+        diffWorkPool_.get(),
+        diffArena_.get());
+
+    // All temporary data of the diff is released at once; the memory is
+    // reused by the next transaction.
+    diffArena_->reset();
+
+    if (isMutationCompactionEnabled_) {
+      // The list spans all revisions committed since the last mount and
+      // might contain work that later revisions undid.
+      telemetry.setNumberOfCompactedMutations(
+          static_cast<int>(compactShadowViewMutations(mutations)));
+    }
 
     telemetry.didDiff();
 
-    transaction = MountingTransaction{
-        surfaceId_, number_, std::move(mutations), telemetry};
+    // The override delegate consumes a regular list, so encoding it would
+    // only be undone right away.
+    if (isCompactMutationEncodingEnabled_ && !shouldOverridePullTransaction) {
+      // `ShadowView`s are moved into the deduplicated table of the list.
+      transaction = MountingTransaction{
+          surfaceId_,
+          number_,
+          CompactShadowViewMutationList{std::move(mutations)},
+          telemetry};
+    } else {
+      transaction = MountingTransaction{
+          surfaceId_, number_, std::move(mutations), telemetry};
+    }
   }
 
   // Override case
-  auto mountingOverrideDelegate = mountingOverrideDelegate_.lock();
-  auto shouldOverridePullTransaction = mountingOverrideDelegate &&
-      mountingOverrideDelegate->shouldOverridePullTransaction();
-
   if (shouldOverridePullTransaction) {
     auto mutations = ShadowViewMutation::List{};
     auto telemetry = TransactionTelemetry{};
 
     if (transaction.has_value()) {
-      mutations = transaction->getMutations();
       telemetry = transaction->getTelemetry();
+      mutations = std::move(*transaction).getMutations();
     } else {
       number_++;
       telemetry.willLayout();
@@ -180,6 +207,28 @@ TelemetryController const &MountingCoordinator::getTelemetryController() const {
   return telemetryController_;
 }
 
+void MountingCoordinator::setDiffWorkPool(
+    DiffWorkPool::Shared diffWorkPool) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  // The arena needs a separate region for every thread of the pool.
+  auto concurrency = diffWorkPool ? diffWorkPool->getConcurrency() : 1;
+  if (diffArena_->getRegionCount() != concurrency) {
+    diffArena_ = std::make_unique<DiffArena>(concurrency);
+  }
+  diffWorkPool_ = std::move(diffWorkPool);
+}
+
+void MountingCoordinator::setMutationCompactionEnabled(bool enabled) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  isMutationCompactionEnabled_ = enabled;
+}
+
+void MountingCoordinator::setCompactMutationEncodingEnabled(
+    bool enabled) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  isCompactMutationEncodingEnabled_ = enabled;
+}
+
 void MountingCoordinator::setMountingOverrideDelegate(
     std::weak_ptr<MountingOverrideDelegate const> delegate) const {
   std::lock_guard<std::mutex> lock(mutex_);
@@ -71,6 +71,32 @@ class MountingCoordinator final {
 
   TelemetryController const &getTelemetryController() const;
 
+  /*
+   * Opts the coordinator into parallel diffing: subsequent transactions
+   * diff independent subtrees concurrently on the given pool. Passing
+   * `nullptr` restores serial diffing (the default).
+   * The produced mutations are identical in both modes.
+   */
+  void setDiffWorkPool(DiffWorkPool::Shared diffWorkPool) const;
+
+  /*
+   * Enables or disables (the default) compaction of mutation lists (see
+   * `compactShadowViewMutations`) for subsequent transactions of the surface.
+   * The number of removed mutations is reported via `TransactionTelemetry`
+   * and aggregated by `TelemetryController`.
+   */
+  void setMutationCompactionEnabled(bool enabled) const;
+
+  /*
+   * Enables or disables (the default) the compact encoding (see
+   * `CompactShadowViewMutationList`) of mutations of subsequent transactions
+   * of the surface. Consumers which call `getMutations()` on such a
+   * transaction decode the list once, so this should only be enabled for
+   * mounting layers which read `getCompactMutations()` (as Android's does).
+   * Transactions handed to a `MountingOverrideDelegate` are never encoded.
+   */
+  void setCompactMutationEncodingEnabled(bool enabled) const;
+
   /*
    * Methods from this section are meant to be used by
    * `MountingOverrideDelegate` only.
@@ -109,6 +135,11 @@ class MountingCoordinator final {
   mutable std::condition_variable signal_;
   mutable std::weak_ptr<MountingOverrideDelegate const>
       mountingOverrideDelegate_;
+  mutable DiffWorkPool::Shared diffWorkPool_; // Protected by `mutex_`.
+  mutable std::unique_ptr<DiffArena> diffArena_; // Protected by `mutex_`.
+  mutable bool isMutationCompactionEnabled_{false}; // Protected by `mutex_`.
+  mutable bool isCompactMutationEncodingEnabled_{
+      false}; // Protected by `mutex_`.
 
   TelemetryController telemetryController_;
 
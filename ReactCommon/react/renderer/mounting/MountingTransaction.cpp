@@ -22,12 +22,82 @@ MountingTransaction::MountingTransaction(
       mutations_(std::move(mutations)),
       telemetry_(std::move(telemetry)) {}
 
+MountingTransaction::MountingTransaction(
+    SurfaceId surfaceId,
+    Number number,
+    CompactShadowViewMutationList &&mutations,
+    TransactionTelemetry telemetry)
+    : surfaceId_(surfaceId),
+      number_(number),
+      compactMutations_(std::move(mutations)),
+      telemetry_(std::move(telemetry)) {}
+
+MountingTransaction::MountingTransaction(
+    const MountingTransaction &mountingTransaction)
+    : surfaceId_(mountingTransaction.surfaceId_),
+      number_(mountingTransaction.number_),
+      telemetry_(mountingTransaction.telemetry_) {
+  std::lock_guard<std::mutex> lock(mountingTransaction.mutex_);
+  mutations_ = mountingTransaction.mutations_;
+  compactMutations_ = mountingTransaction.compactMutations_;
+}
+
+MountingTransaction::MountingTransaction(
+    MountingTransaction &&mountingTransaction) noexcept
+    : surfaceId_(mountingTransaction.surfaceId_),
+      number_(mountingTransaction.number_),
+      mutations_(std::move(mountingTransaction.mutations_)),
+      compactMutations_(std::move(mountingTransaction.compactMutations_)),
+      telemetry_(std::move(mountingTransaction.telemetry_)) {}
+
+MountingTransaction &MountingTransaction::operator=(
+    MountingTransaction &&other) noexcept {
+  surfaceId_ = other.surfaceId_;
+  number_ = other.number_;
+  mutations_ = std::move(other.mutations_);
+  compactMutations_ = std::move(other.compactMutations_);
+  telemetry_ = std::move(other.telemetry_);
+  return *this;
+}
+
 ShadowViewMutationList const &MountingTransaction::getMutations() const & {
-  return mutations_;
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!mutations_.has_value()) {
+    mutations_ = compactMutations_->toList();
+  }
+  return *mutations_;
 }
 
 ShadowViewMutationList MountingTransaction::getMutations() && {
-  return std::move(mutations_);
+  if (!mutations_.has_value()) {
+    return compactMutations_->toList();
+  }
+  return std::move(*mutations_);
+}
+
+CompactShadowViewMutationList const &MountingTransaction::getCompactMutations()
+    const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!compactMutations_.has_value()) {
+    compactMutations_ = CompactShadowViewMutationList{};
+    compactMutations_->reserve(mutations_->size());
+    for (auto const &mutation : *mutations_) {
+      compactMutations_->push_back(mutation);
+    }
+    compactMutations_->shrinkToFit();
+  }
+  return *compactMutations_;
+}
+
+bool MountingTransaction::hasCompactMutations() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return compactMutations_.has_value();
+}
+
+size_t MountingTransaction::getNumberOfMutations() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return mutations_.has_value() ? mutations_->size()
+                                : compactMutations_->size();
 }
 
 TransactionTelemetry const &MountingTransaction::getTelemetry() const {
@@ -7,6 +7,10 @@
 
 #pragma once
 
+#include <mutex>
+#include <optional>
+
+#include <react/renderer/mounting/CompactShadowViewMutationList.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
 #include <react/renderer/telemetry/SurfaceTelemetry.h>
 #include <react/renderer/telemetry/TransactionTelemetry.h>
@@ -39,29 +43,60 @@ class MountingTransaction final {
       ShadowViewMutationList &&mutations,
       TransactionTelemetry telemetry);
 
+  /*
+   * Creates a transaction backed by the compact mutation encoding.
+   */
+  MountingTransaction(
+      SurfaceId surfaceId,
+      Number number,
+      CompactShadowViewMutationList &&mutations,
+      TransactionTelemetry telemetry);
+
   /*
    * Copy semantic.
    * Copying of MountingTransaction is expensive, so copy-constructor is
    * explicit and copy-assignment is deleted to prevent accidental copying.
    */
-  explicit MountingTransaction(const MountingTransaction &mountingTransaction) =
-      default;
+  explicit MountingTransaction(const MountingTransaction &mountingTransaction);
   MountingTransaction &operator=(const MountingTransaction &other) = delete;
 
   /*
    * Move semantic.
    */
-  MountingTransaction(MountingTransaction &&mountingTransaction) noexcept =
-      default;
-  MountingTransaction &operator=(MountingTransaction &&other) = default;
+  MountingTransaction(MountingTransaction &&mountingTransaction) noexcept;
+  MountingTransaction &operator=(MountingTransaction &&other) noexcept;
 
   /*
    * Returns a list of mutations that represent the transaction. The list can be
    * empty (theoretically).
+   * If the transaction was created from a compact list, the regular list is
+   * decoded on the first call.
    */
   ShadowViewMutationList const &getMutations() const &;
   ShadowViewMutationList getMutations() &&;
 
+  /*
+   * Returns the mutations in the compact encoding (which can also be iterated
+   * as a list of `ShadowViewMutation`s).
+   * If the transaction was created from a regular list, the compact list is
+   * encoded on the first call.
+   */
+  CompactShadowViewMutationList const &getCompactMutations() const;
+
+  /*
+   * Returns `true` if the compact encoding is available without encoding
+   * (e.g. the transaction was created from a compact list). Consumers which
+   * can handle both representations should check this to avoid a
+   * conversion.
+   */
+  bool hasCompactMutations() const;
+
+  /*
+   * Returns the number of mutations without converting between
+   * representations.
+   */
+  size_t getNumberOfMutations() const;
+
   /*
    * Returns telemetry associated with this transaction.
    */
@@ -80,7 +115,14 @@ class MountingTransaction final {
  private:
   SurfaceId surfaceId_;
   Number number_;
-  ShadowViewMutationList mutations_;
+  // At least one of the representations is always set; the other one is
+  // derived from it on demand. Once set, a representation is never changed
+  // by `const` methods, so those can be called from multiple threads.
+  mutable std::mutex mutex_;
+  mutable std::optional<ShadowViewMutationList>
+      mutations_; // Protected by `mutex_`.
+  mutable std::optional<CompactShadowViewMutationList>
+      compactMutations_; // Protected by `mutex_`.
   TransactionTelemetry telemetry_;
 };
 
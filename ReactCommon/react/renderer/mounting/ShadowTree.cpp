@@ -7,6 +7,9 @@
 
 #include "ShadowTree.h"
 
+#include <algorithm>
+#include <exception>
+
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/components/root/RootComponentDescriptor.h>
 #include <react/renderer/components/view/ViewShadowNode.h>
@@ -160,13 +163,94 @@ static ShadowNode::Unshared progressState(
   });
 }
 
-static void updateMountedFlag(
+/*
+ * Maximum number of families with obsolete states which are reconciled one by
+ * one (see below). Beyond that, traversing the part of the tree which differs
+ * from the base tree is cheaper than looking up every family separately.
+ */
+static constexpr size_t kMaxNumberOfFamiliesToReconcileSeparately = 32;
+
+/*
+ * Same as above, but only nodes of families that have obsolete states are
+ * visited (see `ShadowNodeFamily::getFamiliesWithObsoleteStates`); they are
+ * found via `ShadowNodeFamily::getAncestors` and only their ancestors get
+ * cloned. So, the cost depends on the number of such families (usually very
+ * few, e.g. scroll views and text inputs), not on the size of the tree.
+ * Falls back to the traversal of the tree when there are many such families.
+ */
+static RootShadowNode::Unshared progressRootState(
+    RootShadowNode const &rootShadowNode,
+    RootShadowNode const &baseRootShadowNode) {
+  auto families = ShadowNodeFamily::getFamiliesWithObsoleteStates(
+      rootShadowNode.getSurfaceId());
+  if (families.empty()) {
+    return nullptr;
+  }
+
+  if (families.size() > kMaxNumberOfFamiliesToReconcileSeparately) {
+    return std::static_pointer_cast<RootShadowNode>(
+        progressState(rootShadowNode, baseRootShadowNode));
+  }
+
+  auto newRootShadowNode = ShadowNode::Unshared{};
+  for (auto const &family : families) {
+    auto const &currentRootShadowNode = newRootShadowNode
+        ? *newRootShadowNode
+        : static_cast<ShadowNode const &>(rootShadowNode);
+
+    auto ancestors = family->getAncestors(currentRootShadowNode);
+    if (ancestors.empty()) {
+      // The family is not a part of the tree.
+      continue;
+    }
+
+    auto const &parent = ancestors.back();
+    auto const &shadowNode = parent.first.get().getChildren().at(parent.second);
+    auto const &state = shadowNode->getState();
+    if (!state) {
+      continue;
+    }
+
+    auto newState = state->getMostRecentStateIfObsolete();
+    if (!newState || newState == state) {
+      continue;
+    }
+
+    newRootShadowNode = currentRootShadowNode.cloneTree(
+        *family, [&](ShadowNode const &oldShadowNode) {
+          return oldShadowNode.clone({
+              ShadowNodeFragment::propsPlaceholder(),
+              ShadowNodeFragment::childrenPlaceholder(),
+              newState,
+          });
+        });
+  }
+
+  return std::static_pointer_cast<RootShadowNode>(newRootShadowNode);
+}
+
+/*
+ * A change of the `mounted` flag of a node. Changes are collected outside of
+ * any lock and applied later while `EventEmitter::DispatchMutex()` is held.
+ */
+struct MountedFlagChange {
+  ShadowNode const *shadowNode;
+  bool mounted;
+};
+
+using MountedFlagChanges = std::vector<MountedFlagChange>;
+
+static void finalizeChildren(
     const SharedShadowNodeList &oldChildren,
-    const SharedShadowNodeList &newChildren) {
+    const SharedShadowNodeList &newChildren,
+    MountedFlagChanges &mountedFlagChanges) {
   // This is a simplified version of Diffing algorithm that only updates
   // `mounted` flag on `ShadowNode`s. The algorithm sets "mounted" flag before
   // "unmounted" to allow `ShadowNode` detect a situation where the node was
   // remounted.
+  // Every new node is visited by the algorithm (nodes shared with the old
+  // tree are skipped; those are sealed and stamped already), so it also seals
+  // and stamps them, children before parents.
 
   if (&oldChildren == &newChildren) {
     // Lists are identical, nothing to do.
@@ -196,10 +280,12 @@ static void updateMountedFlag(
       break;
     }
 
-    newChild->setMounted(true);
-    oldChild->setMounted(false);
+    mountedFlagChanges.push_back({newChild.get(), true});
+    mountedFlagChanges.push_back({oldChild.get(), false});
 
-    updateMountedFlag(oldChild->getChildren(), newChild->getChildren());
+    finalizeChildren(
+        oldChild->getChildren(), newChild->getChildren(), mountedFlagChanges);
+    newChild->sealAndStamp();
   }
 
   size_t lastIndexAfterFirstStage = index;
@@ -207,18 +293,40 @@ static void updateMountedFlag(
   // State 2: Mount new children.
   for (index = lastIndexAfterFirstStage; index < newChildren.size(); index++) {
     const auto &newChild = newChildren[index];
-    newChild->setMounted(true);
-    updateMountedFlag({}, newChild->getChildren());
+    mountedFlagChanges.push_back({newChild.get(), true});
+    finalizeChildren({}, newChild->getChildren(), mountedFlagChanges);
+    newChild->sealAndStamp();
   }
 
   // State 3: Unmount old children.
   for (index = lastIndexAfterFirstStage; index < oldChildren.size(); index++) {
     const auto &oldChild = oldChildren[index];
-    oldChild->setMounted(false);
-    updateMountedFlag(oldChild->getChildren(), {});
+    mountedFlagChanges.push_back({oldChild.get(), false});
+    finalizeChildren(oldChild->getChildren(), {}, mountedFlagChanges);
   }
 }
 
+/*
+ * The post-commit pass over a laid out tree, done in a single traversal:
+ * seals all new nodes, stamps their mount generations (so the differ can skip
+ * mount-equivalent subtrees), and collects changes of `mounted` flags
+ * relative to the old tree.
+ */
+static MountedFlagChanges finalizeTree(
+    ShadowNode const &oldRootShadowNode,
+    ShadowNode const &newRootShadowNode) {
+  SystraceSection s("ShadowTree::finalizeTree");
+
+  auto mountedFlagChanges = MountedFlagChanges{};
+  mountedFlagChanges.reserve(256);
+  finalizeChildren(
+      oldRootShadowNode.getChildren(),
+      newRootShadowNode.getChildren(),
+      mountedFlagChanges);
+  newRootShadowNode.sealAndStamp();
+  return mountedFlagChanges;
+}
+
 ShadowTree::ShadowTree(
     SurfaceId surfaceId,
     LayoutConstraints const &layoutConstraints,
@@ -252,7 +360,10 @@ ShadowTree::ShadowTree(
           family));
 
   currentRevision_ = ShadowTreeRevision{
-      rootShadowNode, INITIAL_REVISION, TransactionTelemetry{}};
+      rootShadowNode,
+      INITIAL_REVISION,
+      TransactionTelemetry{},
+      std::make_shared<ShadowNodeAncestorIndex const>(rootShadowNode)};
 
   mountingCoordinator_ =
       std::make_shared<MountingCoordinator const>(currentRevision_);
@@ -295,17 +406,49 @@ MountingCoordinator::Shared ShadowTree::getMountingCoordinator() const {
   return mountingCoordinator_;
 }
 
+/*
+ * The tree whose commit queue is being drained by the current thread (if any).
+ * Commits issued from queued transactions bypass the queue.
+ */
+static thread_local ShadowTree const *drainingShadowTree = nullptr;
+
+struct ShadowTree::QueuedCommit final {
+  ShadowTreeCommitTransaction transaction;
+  CommitOptions commitOptions;
+  CommitStatus status{CommitStatus::Cancelled};
+  std::exception_ptr exception{};
+  bool isDone{false}; // Protected by `commitQueueMutex_`.
+};
+
+void ShadowTree::setCommitQueueEnabled(bool enabled) const {
+  isCommitQueueEnabled_ = enabled;
+}
+
+void ShadowTree::waitForQueuedCommits(size_t count) const {
+  std::unique_lock<std::mutex> lock(commitQueueMutex_);
+  commitQueueSignal_.wait(
+      lock, [&]() { return commitQueue_.size() >= count; });
+}
+
+void ShadowTree::setLayoutEventBatchingEnabled(bool enabled) const {
+  isLayoutEventBatchingEnabled_ = enabled;
+}
+
 CommitStatus ShadowTree::commit(
     ShadowTreeCommitTransaction transaction,
     CommitOptions commitOptions) const {
   SystraceSection s("ShadowTree::commit");
 
+  if (isCommitQueueEnabled_ && drainingShadowTree != this) {
+    return enqueueCommit(std::move(transaction), std::move(commitOptions));
+  }
+
   int attempts = 0;
 
   while (true) {
     attempts++;
 
-    auto status = tryCommit(transaction, commitOptions);
+    auto status = tryCommit(transaction, commitOptions, attempts - 1);
     if (status != CommitStatus::Failed) {
       return status;
     }
@@ -319,14 +462,21 @@ CommitStatus ShadowTree::commit(
 CommitStatus ShadowTree::tryCommit(
     ShadowTreeCommitTransaction transaction,
     CommitOptions commitOptions) const {
+  return tryCommit(transaction, commitOptions, 0);
+}
+
+CommitStatus ShadowTree::tryCommit(
+    ShadowTreeCommitTransaction const &transaction,
+    CommitOptions const &commitOptions,
+    int numberOfRetries) const {
   SystraceSection s("ShadowTree::tryCommit");
 
   auto telemetry = TransactionTelemetry{};
   telemetry.willCommit();
+  telemetry.setNumberOfCommitRetries(numberOfRetries);
 
   CommitMode commitMode;
   auto oldRevision = ShadowTreeRevision{};
-  auto newRevision = ShadowTreeRevision{};
 
   {
     // Reading `currentRevision_` in shared manner.
@@ -335,7 +485,6 @@ CommitStatus ShadowTree::tryCommit(
     oldRevision = currentRevision_;
   }
 
-  auto const &oldRootShadowNode = oldRevision.rootShadowNode;
   auto newRootShadowNode = transaction(*oldRevision.rootShadowNode);
 
   if (!newRootShadowNode ||
@@ -345,13 +494,29 @@ CommitStatus ShadowTree::tryCommit(
 
   if (commitOptions.enableStateReconciliation) {
     auto updatedNewRootShadowNode =
-        progressState(*newRootShadowNode, *oldRootShadowNode);
+        progressRootState(*newRootShadowNode, *oldRevision.rootShadowNode);
     if (updatedNewRootShadowNode) {
-      newRootShadowNode =
-          std::static_pointer_cast<RootShadowNode>(updatedNewRootShadowNode);
+      newRootShadowNode = std::move(updatedNewRootShadowNode);
     }
   }
 
+  return commitRootShadowNode(
+      oldRevision,
+      commitMode,
+      std::move(newRootShadowNode),
+      telemetry,
+      commitOptions.shouldYield);
+}
+
+CommitStatus ShadowTree::commitRootShadowNode(
+    ShadowTreeRevision const &oldRevision,
+    CommitMode commitMode,
+    RootShadowNode::Unshared newRootShadowNode,
+    TransactionTelemetry &telemetry,
+    std::function<bool()> const &shouldYield) const {
+  auto const &oldRootShadowNode = oldRevision.rootShadowNode;
+  auto newRevision = ShadowTreeRevision{};
+
   // Layout nodes.
   std::vector<LayoutableShadowNode const *> affectedLayoutableNodes{};
   affectedLayoutableNodes.reserve(1024);
@@ -362,8 +527,10 @@ CommitStatus ShadowTree::tryCommit(
   telemetry.unsetAsThreadLocal();
   telemetry.didLayout();
 
-  // Seal the shadow node so it can no longer be mutated
-  newRootShadowNode->sealRecursive();
+  // Seal the shadow node so it can no longer be mutated, and prepare it for
+  // mounting.
+  auto mountedFlagChanges =
+      finalizeTree(*oldRootShadowNode, *newRootShadowNode);
 
   {
     // Updating `currentRevision_` in unique manner if it hasn't changed.
@@ -375,27 +542,38 @@ CommitStatus ShadowTree::tryCommit(
 
     auto newRevisionNumber = oldRevision.number + 1;
 
+    auto finalizedRootShadowNode = newRootShadowNode.get();
     newRootShadowNode = delegate_.shadowTreeWillCommit(
         *this, oldRootShadowNode, newRootShadowNode);
 
-    if (!newRootShadowNode ||
-        (commitOptions.shouldYield && commitOptions.shouldYield())) {
+    if (!newRootShadowNode || (shouldYield && shouldYield())) {
       return CommitStatus::Cancelled;
     }
 
+    if (newRootShadowNode.get() != finalizedRootShadowNode) {
+      // The delegate altered the tree; nodes it cloned have to be finalized
+      // as well.
+      mountedFlagChanges = finalizeTree(*oldRootShadowNode, *newRootShadowNode);
+    }
+
     {
+      // Only the precomputed flag changes are applied while event dispatch
+      // is blocked.
       std::lock_guard<std::mutex> dispatchLock(EventEmitter::DispatchMutex());
 
-      updateMountedFlag(
-          currentRevision_.rootShadowNode->getChildren(),
-          newRootShadowNode->getChildren());
+      for (auto const &mountedFlagChange : mountedFlagChanges) {
+        mountedFlagChange.shadowNode->setMounted(mountedFlagChange.mounted);
+      }
     }
 
     telemetry.didCommit();
     telemetry.setRevisionNumber(static_cast<int>(newRevisionNumber));
 
-    newRevision =
-        ShadowTreeRevision{newRootShadowNode, newRevisionNumber, telemetry};
+    newRevision = ShadowTreeRevision{
+        newRootShadowNode,
+        newRevisionNumber,
+        telemetry,
+        std::make_shared<ShadowNodeAncestorIndex const>(newRootShadowNode)};
 
     currentRevision_ = newRevision;
   }
@@ -409,6 +587,192 @@ CommitStatus ShadowTree::tryCommit(
   return CommitStatus::Succeeded;
 }
 
+#pragma mark - Commit Queue
+
+CommitStatus ShadowTree::enqueueCommit(
+    ShadowTreeCommitTransaction transaction,
+    CommitOptions commitOptions) const {
+  auto queuedCommit = std::make_shared<QueuedCommit>();
+  queuedCommit->transaction = std::move(transaction);
+  queuedCommit->commitOptions = std::move(commitOptions);
+
+  bool shouldDrain;
+
+  {
+    std::unique_lock<std::mutex> lock(commitQueueMutex_);
+    commitQueue_.push_back(queuedCommit);
+    // Wakes up `waitForQueuedCommits`.
+    commitQueueSignal_.notify_all();
+
+    // Either another thread commits the transaction for us, or the thread
+    // which drains the queue is done and this one takes over.
+    commitQueueSignal_.wait(lock, [&]() {
+      return queuedCommit->isDone || !isDrainingCommitQueue_;
+    });
+
+    shouldDrain = !queuedCommit->isDone;
+    if (shouldDrain) {
+      isDrainingCommitQueue_ = true;
+    }
+  }
+
+  if (shouldDrain) {
+    drainCommitQueue(*queuedCommit);
+  }
+
+  if (queuedCommit->exception) {
+    std::rethrow_exception(queuedCommit->exception);
+  }
+
+  return queuedCommit->status;
+}
+
+void ShadowTree::drainCommitQueue(QueuedCommit const &queuedCommit) const {
+  SystraceSection s("ShadowTree::drainCommitQueue");
+
+  auto queuedCommits = std::vector<std::shared_ptr<QueuedCommit>>{};
+
+  {
+    std::lock_guard<std::mutex> lock(commitQueueMutex_);
+    std::swap(queuedCommits, commitQueue_);
+  }
+
+  // Nobody else drains the queue, so it still contains `queuedCommit`.
+  react_native_assert(
+      std::find_if(
+          queuedCommits.begin(),
+          queuedCommits.end(),
+          [&](std::shared_ptr<QueuedCommit> const &item) {
+            return item.get() == &queuedCommit;
+          }) != queuedCommits.end());
+
+  auto previousDrainingShadowTree = drainingShadowTree;
+  drainingShadowTree = this;
+
+  int attempts = 0;
+
+  while (true) {
+    attempts++;
+
+    auto status = tryCommitQueuedCommits(queuedCommits, attempts - 1);
+    if (status != CommitStatus::Failed) {
+      break;
+    }
+
+    // Only `tryCommit` can commit concurrently with the queue.
+    react_native_assert(attempts < 1024);
+  }
+
+  drainingShadowTree = previousDrainingShadowTree;
+
+  {
+    std::lock_guard<std::mutex> lock(commitQueueMutex_);
+    for (auto const &item : queuedCommits) {
+      item->isDone = true;
+    }
+    // Transactions queued in the meantime are committed by one of the
+    // waiting threads.
+    isDrainingCommitQueue_ = false;
+  }
+
+  commitQueueSignal_.notify_all();
+}
+
+CommitStatus ShadowTree::tryCommitQueuedCommits(
+    std::vector<std::shared_ptr<QueuedCommit>> const &queuedCommits,
+    int numberOfRetries) const {
+  SystraceSection s(
+      "ShadowTree::tryCommitQueuedCommits",
+      "numberOfTransactions",
+      queuedCommits.size());
+
+  auto telemetry = TransactionTelemetry{};
+  telemetry.willCommit();
+  telemetry.setNumberOfCommitRetries(numberOfRetries);
+
+  CommitMode commitMode;
+  auto oldRevision = ShadowTreeRevision{};
+
+  {
+    // Reading `currentRevision_` in shared manner.
+    std::shared_lock<butter::shared_mutex> lock(commitMutex_);
+    commitMode = commitMode_;
+    oldRevision = currentRevision_;
+  }
+
+  // Every transaction is applied on top of the result of the previous one.
+  auto rootShadowNode = RootShadowNode::Unshared{};
+  auto numberOfMergedTransactions = 0;
+
+  for (auto const &queuedCommit : queuedCommits) {
+    queuedCommit->status = CommitStatus::Cancelled;
+    queuedCommit->exception = nullptr;
+
+    auto const &commitOptions = queuedCommit->commitOptions;
+    auto const &baseRootShadowNode =
+        rootShadowNode ? *rootShadowNode : *oldRevision.rootShadowNode;
+
+    auto newRootShadowNode = RootShadowNode::Unshared{};
+    try {
+      newRootShadowNode = queuedCommit->transaction(baseRootShadowNode);
+    } catch (...) {
+      // Rethrown on the thread that issued the commit.
+      queuedCommit->exception = std::current_exception();
+      continue;
+    }
+
+    if (!newRootShadowNode ||
+        (commitOptions.shouldYield && commitOptions.shouldYield())) {
+      continue;
+    }
+
+    if (commitOptions.enableStateReconciliation) {
+      auto updatedNewRootShadowNode =
+          progressRootState(*newRootShadowNode, baseRootShadowNode);
+      if (updatedNewRootShadowNode) {
+        newRootShadowNode = std::move(updatedNewRootShadowNode);
+      }
+    }
+
+    queuedCommit->status = CommitStatus::Succeeded;
+    rootShadowNode = std::move(newRootShadowNode);
+    numberOfMergedTransactions++;
+  }
+
+  if (!rootShadowNode) {
+    return CommitStatus::Cancelled;
+  }
+
+  telemetry.setNumberOfMergedTransactions(numberOfMergedTransactions);
+
+  // The merged revision yields only if all of its transactions do.
+  auto shouldYield = [&]() {
+    for (auto const &queuedCommit : queuedCommits) {
+      auto const &commitOptions = queuedCommit->commitOptions;
+      if (queuedCommit->status == CommitStatus::Succeeded &&
+          !(commitOptions.shouldYield && commitOptions.shouldYield())) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  auto status = commitRootShadowNode(
+      oldRevision,
+      commitMode,
+      std::move(rootShadowNode),
+      telemetry,
+      shouldYield);
+
+  if (status == CommitStatus::Cancelled) {
+    for (auto const &queuedCommit : queuedCommits) {
+      queuedCommit->status = CommitStatus::Cancelled;
+    }
+  }
+
+  return status;
+}
+
 ShadowTreeRevision ShadowTree::getCurrentRevision() const {
   std::shared_lock<butter::shared_mutex> lock(commitMutex_);
   return currentRevision_;
@@ -438,6 +802,12 @@ void ShadowTree::emitLayoutEvents(
       "affectedLayoutableNodes",
       affectedLayoutableNodes.size());
 
+  auto isBatchingEnabled = isLayoutEventBatchingEnabled_.load();
+  auto layoutEventBatch = ViewEventEmitter::LayoutEventBatch{};
+  if (isBatchingEnabled) {
+    layoutEventBatch.reserve(affectedLayoutableNodes.size());
+  }
+
   for (auto const *layoutableNode : affectedLayoutableNodes) {
     // Only instances of `ViewShadowNode` (and subclasses) are supported.
     auto const &viewShadowNode =
@@ -453,8 +823,15 @@ void ShadowTree::emitLayoutEvents(
       continue;
     }
 
-    viewEventEmitter.onLayout(layoutableNode->getLayoutMetrics());
+    if (isBatchingEnabled) {
+      layoutEventBatch.add(
+          viewEventEmitter, layoutableNode->getLayoutMetrics());
+    } else {
+      viewEventEmitter.onLayout(layoutableNode->getLayoutMetrics());
+    }
   }
+
+  layoutEventBatch.dispatch();
 }
 
 void ShadowTree::notifyDelegatesOfUpdates() const {
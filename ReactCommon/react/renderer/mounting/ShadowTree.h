@@ -8,7 +8,11 @@
 #pragma once
 
 #include <butter/mutex.h>
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include <react/renderer/components/root/RootComponentDescriptor.h>
 #include <react/renderer/components/root/RootShadowNode.h>
@@ -100,11 +104,40 @@ class ShadowTree final {
 
   /*
    * Calls `tryCommit` in a loop until it finishes successfully.
+   * If the commit queue is enabled, the transaction is queued instead and
+   * applied together with concurrently queued ones (see
+   * `setCommitQueueEnabled`).
    */
   CommitStatus commit(
       ShadowTreeCommitTransaction transaction,
       CommitOptions commitOptions = {false}) const;
 
+  /*
+   * Enables or disables (the default) the commit queue.
+   * With the queue, concurrent `commit` calls do not race and retry each
+   * other: one of the calling threads applies all queued transactions in
+   * sequence on top of the current revision and commits the result with a
+   * single layout pass and a single mount. The other callers block until
+   * their transactions are committed (or cancelled).
+   * `tryCommit` is never queued.
+   */
+  void setCommitQueueEnabled(bool enabled) const;
+
+  /*
+   * Blocks until at least `count` transactions are waiting in the commit
+   * queue (i.e. are queued but not yet being applied).
+   * Meant to be used by tests which need to order concurrent commits.
+   */
+  void waitForQueuedCommits(size_t count) const;
+
+  /*
+   * Enables or disables (the default) batching of `layout` events.
+   * With batching, the `layout` events caused by a commit are delivered as
+   * a single batched event (see `ViewEventEmitter::LayoutEventBatch`)
+   * instead of one event per affected node.
+   */
+  void setLayoutEventBatchingEnabled(bool enabled) const;
+
   /*
    * Returns a `ShadowTreeRevision` representing the momentary state of
    * the `ShadowTree`.
@@ -128,6 +161,41 @@ class ShadowTree final {
  private:
   constexpr static ShadowTreeRevision::Number INITIAL_REVISION{0};
 
+  struct QueuedCommit;
+
+  CommitStatus tryCommit(
+      ShadowTreeCommitTransaction const &transaction,
+      CommitOptions const &commitOptions,
+      int numberOfRetries) const;
+
+  /*
+   * Lays out, seals and commits `newRootShadowNode` as the revision following
+   * `oldRevision`. Fails if `oldRevision` is no longer the current one.
+   */
+  CommitStatus commitRootShadowNode(
+      ShadowTreeRevision const &oldRevision,
+      CommitMode commitMode,
+      RootShadowNode::Unshared newRootShadowNode,
+      TransactionTelemetry &telemetry,
+      std::function<bool()> const &shouldYield) const;
+
+  CommitStatus enqueueCommit(
+      ShadowTreeCommitTransaction transaction,
+      CommitOptions commitOptions) const;
+
+  /*
+   * Applies and commits all queued transactions until `queuedCommit` is done.
+   */
+  void drainCommitQueue(QueuedCommit const &queuedCommit) const;
+
+  /*
+   * Applies the given transactions in sequence and commits the result.
+   * Fails if another revision was committed in the meantime.
+   */
+  CommitStatus tryCommitQueuedCommits(
+      std::vector<std::shared_ptr<QueuedCommit>> const &queuedCommits,
+      int numberOfRetries) const;
+
   void mount(ShadowTreeRevision const &revision) const;
 
   void emitLayoutEvents(
@@ -139,6 +207,14 @@ class ShadowTree final {
   mutable CommitMode commitMode_{
       CommitMode::Normal}; // Protected by `commitMutex_`.
   mutable ShadowTreeRevision currentRevision_; // Protected by `commitMutex_`.
+  mutable std::atomic<bool> isCommitQueueEnabled_{false};
+  mutable std::atomic<bool> isLayoutEventBatchingEnabled_{false};
+  mutable std::mutex commitQueueMutex_;
+  mutable std::condition_variable commitQueueSignal_;
+  mutable std::vector<std::shared_ptr<QueuedCommit>>
+      commitQueue_; // Protected by `commitQueueMutex_`.
+  mutable bool isDrainingCommitQueue_{
+      false}; // Protected by `commitQueueMutex_`.
   MountingCoordinator::Shared mountingCoordinator_;
 };
 
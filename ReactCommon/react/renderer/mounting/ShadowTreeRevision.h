@@ -8,6 +8,7 @@
 #pragma once
 
 #include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/core/ShadowNodeAncestorIndex.h>
 #include <react/renderer/mounting/MountingOverrideDelegate.h>
 #include <react/renderer/mounting/MountingTransaction.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
@@ -34,6 +35,13 @@ class ShadowTreeRevision final {
   RootShadowNode::Shared rootShadowNode;
   Number number;
   TransactionTelemetry telemetry;
+
+  /*
+   * Index of `rootShadowNode` for ancestor queries (e.g. measuring) against
+   * this revision. Shared by all copies of the revision and materialized
+   * lazily by the queries themselves.
+   */
+  ShadowNodeAncestorIndex::Shared ancestorIndex;
 };
 
 } // namespace react
@@ -15,6 +15,7 @@
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/debug/flags.h>
+#include <react/renderer/mounting/DiffArena.h>
 
 namespace facebook {
 namespace react {
@@ -65,8 +66,9 @@ std::vector<DebugStringConvertibleObject> getDebugProps(
  *
  */
 struct ShadowViewNodePair final {
-  using NonOwningList = butter::
-      small_vector<ShadowViewNodePair *, kShadowNodeChildrenSmallVectorSize>;
+  using NonOwningList = DiffArenaSmallVector<
+      ShadowViewNodePair *,
+      kShadowNodeChildrenSmallVectorSize>;
   using OwningList = butter::
       small_vector<ShadowViewNodePair, kShadowNodeChildrenSmallVectorSize>;
 
@@ -86,6 +86,24 @@ bool ShadowViewMutation::mutatedViewIsVirtual() const {
   return viewIsVirtual;
 }
 
+PropsChangeSet const *ShadowViewMutation::getPropsChangeSet() const {
+  if (type != Update || !oldChildShadowView.props ||
+      !newChildShadowView.props) {
+    return nullptr;
+  }
+
+  if (oldChildShadowView.props == newChildShadowView.props) {
+    return &PropsChangeSet::empty();
+  }
+
+  auto const &changeSet = newChildShadowView.props->changeSet;
+  if (!changeSet.isRelativeTo(oldChildShadowView.props->changeSet)) {
+    return nullptr;
+  }
+
+  return &changeSet;
+}
+
 ShadowViewMutation::ShadowViewMutation(
     Type type,
     ShadowView parentShadowView,
@@ -79,7 +79,20 @@ struct ShadowViewMutation final {
   // highly recommended that you NOT make use of this in your platform!
   bool mutatedViewIsVirtual() const;
 
+  /*
+   * For `Update` mutations, returns the set of props that might differ between
+   * `oldChildShadowView.props` and `newChildShadowView.props` (see
+   * `PropsChangeSet`), so the mounting layer can apply only those. Returns a
+   * known empty set (`PropsChangeSet::empty()`) if the props objects are the
+   * same, and `nullptr` if it is unknown which props changed (e.g. the new
+   * props were not cloned directly from the old ones); all props have to be
+   * compared then.
+   */
+  PropsChangeSet const *getPropsChangeSet() const;
+
  private:
+  friend class CompactShadowViewMutationList;
+
   ShadowViewMutation(
       Type type,
       ShadowView parentShadowView,
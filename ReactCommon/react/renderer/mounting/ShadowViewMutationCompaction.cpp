@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ShadowViewMutationCompaction.h"
+
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+static constexpr size_t kNoMutation = std::numeric_limits<size_t>::max();
+
+/*
+ * Everything the compaction pass needs to know about a single tag.
+ */
+struct CompactionTagRecord final {
+  /*
+   * The last mutation that referenced the tag (as a child or as a parent).
+   */
+  size_t lastReference{kNoMutation};
+
+  /*
+   * The `Create` mutation of the tag if the view was created by the list.
+   * The fields below are only maintained for such views.
+   */
+  size_t create{kNoMutation};
+
+  /*
+   * Whether the view can still disappear together with its `Create`: it was
+   * never a parent and every `Insert` of it was immediately undone.
+   */
+  bool isTransient{false};
+
+  /*
+   * An `Insert` of the view that is not yet matched with a `Remove`.
+   */
+  size_t pendingInsert{kNoMutation};
+
+  /*
+   * All mutations referencing the view since its `Create`.
+   */
+  std::vector<size_t> references{};
+};
+
+size_t compactShadowViewMutations(ShadowViewMutation::List &mutations) {
+  auto isDropped = std::vector<bool>(mutations.size(), false);
+  auto records = std::unordered_map<Tag, CompactionTagRecord>{};
+  records.reserve(mutations.size());
+
+  // Whether the mutation at `index` is a live mutation of the given type
+  // whose child is the view with the given tag.
+  auto isMergeCandidate =
+      [&](size_t index, ShadowViewMutation::Type type, Tag tag) {
+        if (index == kNoMutation || isDropped[index]) {
+          return false;
+        }
+        auto const &candidate = mutations[index];
+        auto candidateTag = candidate.type == ShadowViewMutation::Remove
+            ? candidate.oldChildShadowView.tag
+            : candidate.newChildShadowView.tag;
+        return candidate.type == type && candidateTag == tag;
+      };
+
+  for (size_t i = 0; i < mutations.size(); i++) {
+    auto &mutation = mutations[i];
+
+    switch (mutation.type) {
+      case ShadowViewMutation::Create: {
+        auto &record = records[mutation.newChildShadowView.tag];
+        record = CompactionTagRecord{};
+        record.create = i;
+        record.isTransient = true;
+        record.lastReference = i;
+        break;
+      }
+
+      case ShadowViewMutation::Update: {
+        auto &record = records[mutation.newChildShadowView.tag];
+        auto previous = record.lastReference;
+
+        if (isMergeCandidate(
+                previous,
+                ShadowViewMutation::Update,
+                mutation.newChildShadowView.tag)) {
+          mutation.oldChildShadowView =
+              std::move(mutations[previous].oldChildShadowView);
+          isDropped[previous] = true;
+          if (mutation.oldChildShadowView == mutation.newChildShadowView) {
+            isDropped[i] = true;
+          }
+        } else if (isMergeCandidate(
+                       previous,
+                       ShadowViewMutation::Create,
+                       mutation.newChildShadowView.tag)) {
+          // The view is created with its final content right away.
+          mutations[previous].newChildShadowView =
+              std::move(mutation.newChildShadowView);
+          isDropped[i] = true;
+          // The `Create` stays the last reference of the tag.
+          break;
+        }
+
+        if (record.create != kNoMutation) {
+          record.references.push_back(i);
+        }
+        record.lastReference = i;
+        break;
+      }
+
+      case ShadowViewMutation::Insert: {
+        auto parentTag = mutation.parentShadowView.tag;
+        auto &record = records[mutation.newChildShadowView.tag];
+        auto &parentRecord = records[parentTag];
+        auto previous = record.lastReference;
+
+        if (record.create == kNoMutation &&
+            isMergeCandidate(
+                previous,
+                ShadowViewMutation::Remove,
+                mutation.newChildShadowView.tag) &&
+            parentRecord.lastReference == previous &&
+            mutations[previous].parentShadowView.tag == parentTag &&
+            mutations[previous].index == mutation.index) {
+          auto &remove = mutations[previous];
+          isDropped[previous] = true;
+          if (remove.oldChildShadowView == mutation.newChildShadowView) {
+            isDropped[i] = true;
+          } else {
+            mutation = ShadowViewMutation::UpdateMutation(
+                std::move(remove.oldChildShadowView),
+                std::move(mutation.newChildShadowView));
+          }
+        }
+
+        if (record.create != kNoMutation) {
+          if (record.pendingInsert == kNoMutation) {
+            record.pendingInsert = i;
+          } else {
+            record.isTransient = false;
+          }
+          record.references.push_back(i);
+        }
+        parentRecord.isTransient = false;
+        record.lastReference = i;
+        parentRecord.lastReference = i;
+        break;
+      }
+
+      case ShadowViewMutation::Remove: {
+        auto parentTag = mutation.parentShadowView.tag;
+        auto &record = records[mutation.oldChildShadowView.tag];
+        auto &parentRecord = records[parentTag];
+
+        if (record.create != kNoMutation) {
+          auto insert = record.pendingInsert;
+          auto isInsertUndone = insert != kNoMutation &&
+              record.lastReference == insert &&
+              parentRecord.lastReference == insert &&
+              mutations[insert].parentShadowView.tag == parentTag &&
+              mutations[insert].index == mutation.index;
+          if (!isInsertUndone) {
+            record.isTransient = false;
+          }
+          record.pendingInsert = kNoMutation;
+          record.references.push_back(i);
+        }
+        parentRecord.isTransient = false;
+        record.lastReference = i;
+        parentRecord.lastReference = i;
+        break;
+      }
+
+      case ShadowViewMutation::Delete: {
+        auto &record = records[mutation.oldChildShadowView.tag];
+
+        if (record.create != kNoMutation && record.isTransient &&
+            record.pendingInsert == kNoMutation) {
+          isDropped[record.create] = true;
+          for (auto reference : record.references) {
+            isDropped[reference] = true;
+          }
+          isDropped[i] = true;
+        }
+
+        record = CompactionTagRecord{};
+        record.lastReference = i;
+        break;
+      }
+    }
+  }
+
+  auto size = size_t{0};
+  for (size_t i = 0; i < mutations.size(); i++) {
+    if (isDropped[i]) {
+      continue;
+    }
+    if (size != i) {
+      mutations[size] = std::move(mutations[i]);
+    }
+    size++;
+  }
+
+  auto numberOfDroppedMutations = mutations.size() - size;
+  mutations.erase(mutations.begin() + size, mutations.end());
+  return numberOfDroppedMutations;
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/mounting/ShadowViewMutation.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Removes redundant work from the given list of mutations in place:
+ *  - `Create` and `Delete` of a view that is never observed in between
+ *    (only updated, or inserted and immediately removed again) are dropped
+ *    together with everything that references the view;
+ *  - an `Update` that immediately follows a `Create` or another `Update` of
+ *    the same view is merged into it; merged `Update`s that end up being
+ *    no-ops are dropped;
+ *  - a `Remove` immediately followed by an `Insert` of the same view into the
+ *    same parent at the same index is dropped, or replaced with an `Update` if
+ *    the inserted view differs from the removed one.
+ * "Immediately" means that no mutation in between references the view (or
+ * the parent, for `Insert`s and `Remove`s), so the resulting list describes
+ * the same final state and stays valid for sequential application (e.g. by
+ * `StubViewTree`).
+ * Returns the number of removed mutations.
+ */
+size_t compactShadowViewMutations(ShadowViewMutation::List &mutations);
+
+} // namespace react
+} // namespace facebook
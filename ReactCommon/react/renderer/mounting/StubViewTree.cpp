@@ -39,6 +39,15 @@ size_t StubViewTree::size() const {
 }
 
 void StubViewTree::mutate(ShadowViewMutationList const &mutations) {
+  mutateImpl(mutations);
+}
+
+void StubViewTree::mutate(CompactShadowViewMutationList const &mutations) {
+  mutateImpl(mutations);
+}
+
+template <typename MutationListT>
+void StubViewTree::mutateImpl(MutationListT const &mutations) {
   STUB_VIEW_LOG({ LOG(ERROR) << "StubView: Mutating Begin"; });
   for (auto const &mutation : mutations) {
     switch (mutation.type) {
@@ -10,6 +10,7 @@
 #include <memory>
 #include <unordered_map>
 
+#include <react/renderer/mounting/CompactShadowViewMutationList.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
 #include <react/renderer/mounting/StubView.h>
 
@@ -22,6 +23,7 @@ class StubViewTree {
   StubViewTree(ShadowView const &shadowView);
 
   void mutate(ShadowViewMutationList const &mutations);
+  void mutate(CompactShadowViewMutationList const &mutations);
 
   StubView const &getRootStubView() const;
 
@@ -36,6 +38,9 @@ class StubViewTree {
   size_t size() const;
 
  private:
+  template <typename MutationListT>
+  void mutateImpl(MutationListT const &mutations);
+
   Tag rootTag;
   std::unordered_map<Tag, StubView::Shared> registry{};
 
@@ -31,7 +31,7 @@ bool TelemetryController::pullTransaction(
   auto surfaceId = transaction.getSurfaceId();
   auto number = transaction.getNumber();
   auto telemetry = transaction.getTelemetry();
-  auto numberOfMutations = static_cast<int>(transaction.getMutations().size());
+  auto numberOfMutations = static_cast<int>(transaction.getNumberOfMutations());
 
   mutex_.lock();
   auto compoundTelemetry = compoundTelemetry_;
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <thread>
+#include <vector>
+
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/mounting/CompactShadowViewMutationList.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/MountingTransaction.h>
+
+#include <react/renderer/mounting/stubs.h>
+#include <react/test_utils/Entropy.h>
+#include <react/test_utils/shadowTreeGeneration.h>
+
+namespace facebook {
+namespace react {
+
+static void expectMutationListsEqual(
+    ShadowViewMutation::List const &expectedMutations,
+    ShadowViewMutation::List const &actualMutations) {
+  ASSERT_EQ(expectedMutations.size(), actualMutations.size());
+
+  for (size_t i = 0; i < expectedMutations.size(); i++) {
+    auto const &lhs = expectedMutations[i];
+    auto const &rhs = actualMutations[i];
+    EXPECT_EQ(lhs.type, rhs.type) << "Mutation #" << i;
+    EXPECT_EQ(lhs.index, rhs.index) << "Mutation #" << i;
+    EXPECT_TRUE(lhs.parentShadowView == rhs.parentShadowView)
+        << "Mutation #" << i;
+    EXPECT_TRUE(lhs.oldChildShadowView == rhs.oldChildShadowView)
+        << "Mutation #" << i;
+    EXPECT_TRUE(lhs.newChildShadowView == rhs.newChildShadowView)
+        << "Mutation #" << i;
+  }
+}
+
+static void testCompactEncodingRoundTrip(
+    uint_fast32_t seed,
+    int treeSize,
+    int repeats,
+    int stages) {
+  auto entropy = seed == 0 ? Entropy() : Entropy(seed);
+
+  auto eventDispatcher = EventDispatcher::Shared{};
+  auto contextContainer = std::make_shared<ContextContainer>();
+  auto componentDescriptorParameters =
+      ComponentDescriptorParameters{eventDispatcher, contextContainer, nullptr};
+  auto viewComponentDescriptor =
+      ViewComponentDescriptor(componentDescriptorParameters);
+  auto rootComponentDescriptor =
+      RootComponentDescriptor(componentDescriptorParameters);
+
+  PropsParserContext parserContext{-1, *contextContainer};
+
+  for (int i = 0; i < repeats; i++) {
+    auto family = rootComponentDescriptor.createFamily(
+        {Tag(1), SurfaceId(1), nullptr}, nullptr);
+
+    // Creating an initial root shadow node.
+    auto emptyRootNode = std::const_pointer_cast<RootShadowNode>(
+        std::static_pointer_cast<RootShadowNode const>(
+            rootComponentDescriptor.createShadowNode(
+                ShadowNodeFragment{RootShadowNode::defaultSharedProps()},
+                family)));
+
+    // Applying size constraints.
+    emptyRootNode = emptyRootNode->clone(
+        parserContext,
+        LayoutConstraints{
+            Size{512, 0}, Size{512, std::numeric_limits<Float>::infinity()}},
+        LayoutContext{});
+
+    // Generation of a random tree.
+    auto singleRootChildNode =
+        generateShadowNodeTree(entropy, viewComponentDescriptor, treeSize);
+
+    // Injecting a tree into the root node.
+    auto currentRootNode = std::static_pointer_cast<RootShadowNode const>(
+        emptyRootNode->ShadowNode::clone(ShadowNodeFragment{
+            ShadowNodeFragment::propsPlaceholder(),
+            std::make_shared<SharedShadowNodeList>(
+                SharedShadowNodeList{singleRootChildNode})}));
+
+    // The initial mount is applied through the compatibility iterator.
+    auto viewTree = buildStubViewTreeWithoutUsingDifferentiator(*emptyRootNode);
+    auto initialMutations =
+        calculateShadowViewMutations(*emptyRootNode, *currentRootNode);
+    auto initialCompactMutations = CompactShadowViewMutationList(
+        ShadowViewMutationList{initialMutations});
+
+    expectMutationListsEqual(
+        initialMutations, initialCompactMutations.toList());
+
+    // Every mounted view appears in `Create` and `Insert` mutations, but is
+    // stored in the table only once.
+    EXPECT_LT(
+        initialCompactMutations.getShadowViewCount(),
+        initialMutations.size());
+
+    viewTree.mutate(initialCompactMutations);
+    EXPECT_TRUE(
+        viewTree ==
+        buildStubViewTreeWithoutUsingDifferentiator(*currentRootNode));
+
+    for (int j = 0; j < stages; j++) {
+      auto nextRootNode = currentRootNode;
+
+      alterShadowTree(
+          entropy,
+          nextRootNode,
+          {
+              &messWithChildren,
+              &messWithYogaStyles,
+              &messWithLayoutableOnlyFlag,
+              &messWithNodeFlattenednessFlags,
+          });
+
+      std::vector<LayoutableShadowNode const *> affectedLayoutableNodes{};
+      affectedLayoutableNodes.reserve(1024);
+
+      // Laying out the tree.
+      std::const_pointer_cast<RootShadowNode>(nextRootNode)
+          ->layoutIfNeeded(&affectedLayoutableNodes);
+
+      nextRootNode->sealRecursive();
+
+      auto mutations =
+          calculateShadowViewMutations(*currentRootNode, *nextRootNode);
+
+      auto transaction = MountingTransaction{
+          SurfaceId(1),
+          j + 1,
+          CompactShadowViewMutationList(ShadowViewMutationList{mutations}),
+          TransactionTelemetry{}};
+
+      // Regular consumers see the same list as the one the differ produced.
+      expectMutationListsEqual(mutations, transaction.getMutations());
+
+      viewTree.mutate(transaction.getCompactMutations());
+      EXPECT_TRUE(
+          viewTree ==
+          buildStubViewTreeWithoutUsingDifferentiator(*nextRootNode));
+
+      currentRootNode = nextRootNode;
+    }
+  }
+}
+
+} // namespace react
+} // namespace facebook
+
+using namespace facebook::react;
+
+TEST(CompactShadowViewMutationListTest, sharedViewsAreStoredOnce) {
+  auto parentShadowView = ShadowView{};
+  parentShadowView.tag = 1;
+  auto childShadowView = ShadowView{};
+  childShadowView.tag = 2;
+
+  auto mutations = CompactShadowViewMutationList{};
+  mutations.push_back(ShadowViewMutation::CreateMutation(childShadowView));
+  mutations.push_back(ShadowViewMutation::InsertMutation(
+      parentShadowView, childShadowView, 0));
+  mutations.push_back(ShadowViewMutation::RemoveMutation(
+      parentShadowView, childShadowView, 0));
+  mutations.push_back(ShadowViewMutation::DeleteMutation(childShadowView));
+
+  EXPECT_EQ(mutations.size(), size_t{4});
+
+  // The empty view, the parent and the child.
+  EXPECT_EQ(mutations.getShadowViewCount(), size_t{3});
+
+  auto const &insert = mutations.getCompactMutation(1);
+  EXPECT_EQ(insert.type, ShadowViewMutation::Insert);
+  EXPECT_EQ(insert.parentTag, 1);
+  EXPECT_EQ(insert.childTag, 2);
+  EXPECT_EQ(insert.index, 0);
+  EXPECT_EQ(
+      insert.oldChildShadowView,
+      CompactShadowViewMutation::kEmptyShadowViewIndex);
+  EXPECT_EQ(mutations.getShadowView(insert.newChildShadowView).tag, 2);
+
+  auto const &remove = mutations.getCompactMutation(2);
+  EXPECT_EQ(remove.childTag, 2);
+  EXPECT_EQ(remove.oldChildShadowView, insert.newChildShadowView);
+
+  auto types = std::vector<ShadowViewMutation::Type>{};
+  for (auto const &mutation : mutations) {
+    types.push_back(mutation.type);
+  }
+  EXPECT_EQ(
+      types,
+      (std::vector<ShadowViewMutation::Type>{
+          ShadowViewMutation::Create,
+          ShadowViewMutation::Insert,
+          ShadowViewMutation::Remove,
+          ShadowViewMutation::Delete}));
+}
+
+TEST(CompactShadowViewMutationListTest, viewsDifferingInTraitsAreNotShared) {
+  auto shadowView = ShadowView{};
+  shadowView.tag = 2;
+  auto otherShadowView = shadowView;
+  otherShadowView.traits.set(ShadowNodeTraits::Trait::FormsView);
+
+  auto mutations = CompactShadowViewMutationList{};
+  mutations.push_back(ShadowViewMutation::CreateMutation(shadowView));
+  mutations.push_back(ShadowViewMutation::CreateMutation(otherShadowView));
+
+  EXPECT_EQ(mutations.getShadowViewCount(), size_t{3});
+  EXPECT_TRUE(mutations.getMutation(1).newChildShadowView.traits.check(
+      ShadowNodeTraits::Trait::FormsView));
+}
+
+TEST(CompactShadowViewMutationListTest, shrinkToFitKeepsMutations) {
+  auto parentShadowView = ShadowView{};
+  parentShadowView.tag = 1;
+  auto childShadowView = ShadowView{};
+  childShadowView.tag = 2;
+
+  auto mutations = CompactShadowViewMutationList{ShadowViewMutationList{
+      ShadowViewMutation::CreateMutation(childShadowView),
+      ShadowViewMutation::InsertMutation(
+          parentShadowView, childShadowView, 0)}};
+
+  // The constructor already released the index; views are still shared.
+  EXPECT_EQ(mutations.getShadowViewCount(), size_t{3});
+  EXPECT_EQ(mutations.getMutation(1).parentShadowView.tag, 1);
+  EXPECT_EQ(mutations.getMutation(1).newChildShadowView.tag, 2);
+
+  // Appending after `shrinkToFit()` still produces valid mutations.
+  mutations.push_back(ShadowViewMutation::DeleteMutation(childShadowView));
+  EXPECT_EQ(mutations.size(), size_t{3});
+  EXPECT_EQ(mutations.getMutation(2).oldChildShadowView.tag, 2);
+}
+
+TEST(CompactShadowViewMutationListTest, transactionDoesNotConvertToCount) {
+  auto shadowView = ShadowView{};
+  shadowView.tag = 2;
+
+  auto compactMutations = CompactShadowViewMutationList{};
+  compactMutations.push_back(ShadowViewMutation::CreateMutation(shadowView));
+  auto compactTransaction = MountingTransaction{
+      SurfaceId(1), 1, std::move(compactMutations), TransactionTelemetry{}};
+  EXPECT_TRUE(compactTransaction.hasCompactMutations());
+  EXPECT_EQ(compactTransaction.getNumberOfMutations(), size_t{1});
+  EXPECT_EQ(
+      compactTransaction.getCompactMutations().mutatedViewIsVirtual(0),
+      compactTransaction.getMutations()[0].mutatedViewIsVirtual());
+
+  auto transaction = MountingTransaction{
+      SurfaceId(1),
+      1,
+      ShadowViewMutationList{ShadowViewMutation::CreateMutation(shadowView)},
+      TransactionTelemetry{}};
+  EXPECT_FALSE(transaction.hasCompactMutations());
+  EXPECT_EQ(transaction.getNumberOfMutations(), size_t{1});
+}
+
+TEST(CompactShadowViewMutationListTest, concurrentDecoding) {
+  auto shadowView = ShadowView{};
+  shadowView.tag = 2;
+
+  auto mutations = CompactShadowViewMutationList{};
+  for (int i = 0; i < 1000; i++) {
+    mutations.push_back(ShadowViewMutation::CreateMutation(shadowView));
+  }
+
+  auto transaction = MountingTransaction{
+      SurfaceId(1), 1, std::move(mutations), TransactionTelemetry{}};
+
+  // `const` methods decode the list on demand and may race with each other.
+  auto threads = std::vector<std::thread>{};
+  auto decodedMutations = std::vector<ShadowViewMutationList const *>(4);
+  for (size_t i = 0; i < decodedMutations.size(); i++) {
+    threads.emplace_back([&, i]() {
+      decodedMutations[i] = &transaction.getMutations();
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (auto decoded : decodedMutations) {
+    EXPECT_EQ(decoded, &transaction.getMutations());
+  }
+  EXPECT_EQ(transaction.getMutations().size(), size_t{1000});
+}
+
+TEST(CompactShadowViewMutationListTest, roundTripOfDifferentiatorOutput) {
+  testCompactEncodingRoundTrip(
+      /* seed */ 1,
+      /* size */ 256,
+      /* repeats */ 8,
+      /* stages */ 16);
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <react/renderer/mounting/DiffArena.h>
+#include <react/renderer/mounting/DiffWorkPool.h>
+
+using namespace facebook::react;
+
+TEST(DiffArenaTest, allocationsAreAlignedAndDistinct) {
+  auto arena = DiffArena{1, 256};
+
+  auto first = arena.allocate(3, 1);
+  auto second = arena.allocate(sizeof(double), alignof(double));
+  auto third = arena.allocate(512, alignof(std::max_align_t));
+
+  EXPECT_NE(first, second);
+  EXPECT_NE(second, third);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(second) % alignof(double), 0);
+  EXPECT_EQ(
+      reinterpret_cast<uintptr_t>(third) % alignof(std::max_align_t), 0);
+
+  // The oversized allocation required a dedicated chunk.
+  EXPECT_EQ(arena.getCapacity(), 256 + 512);
+}
+
+TEST(DiffArenaTest, resetReusesMemory) {
+  auto arena = DiffArena{1, 1024};
+
+  auto first = arena.allocate(64, 8);
+  arena.allocate(64, 8);
+  auto capacity = arena.getCapacity();
+
+  arena.reset();
+
+  EXPECT_EQ(arena.allocate(64, 8), first);
+  EXPECT_EQ(arena.getCapacity(), capacity);
+}
+
+TEST(DiffArenaTest, resetReleasesUnusedChunks) {
+  auto arena = DiffArena{1, 128};
+
+  for (int i = 0; i < 8; i++) {
+    arena.allocate(128, 8);
+  }
+  EXPECT_EQ(arena.getCapacity(), 8 * 128);
+
+  // The first reset keeps everything the last diff needed.
+  arena.reset();
+  EXPECT_EQ(arena.getCapacity(), 8 * 128);
+
+  // A smaller diff lets the arena shrink on the next reset.
+  arena.allocate(128, 8);
+  arena.reset();
+  EXPECT_EQ(arena.getCapacity(), 128);
+}
+
+TEST(DiffArenaTest, allocatorWorksWithStandardContainers) {
+  auto arena = DiffArena{};
+  auto allocator = DiffArenaAllocator<int>{&arena};
+
+  auto vector = std::vector<int, DiffArenaAllocator<int>>(allocator);
+  auto deque = std::deque<int, DiffArenaAllocator<int>>(allocator);
+  for (int i = 0; i < 1000; i++) {
+    vector.push_back(i);
+    deque.push_back(i);
+  }
+
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_EQ(vector[i], i);
+    EXPECT_EQ(deque[i], i);
+  }
+  EXPECT_GT(arena.getCapacity(), 0);
+}
+
+TEST(DiffArenaTest, allocatorWithoutArenaUsesHeap) {
+  auto vector = std::vector<int, DiffArenaAllocator<int>>{};
+  vector.assign(1000, 42);
+
+  EXPECT_EQ(vector.size(), 1000);
+  EXPECT_EQ(vector.get_allocator().getArena(), nullptr);
+}
+
+TEST(DiffArenaTest, workerThreadsUseSeparateRegions) {
+  auto workPool = DiffWorkPool{4};
+  auto arena = DiffArena{workPool.getConcurrency(), 1024};
+
+  auto results = std::vector<std::vector<int, DiffArenaAllocator<int>>>{};
+  for (size_t i = 0; i < 64; i++) {
+    results.emplace_back(DiffArenaAllocator<int>{&arena});
+  }
+
+  workPool.parallelFor(results.size(), [&](size_t index) {
+    for (int i = 0; i < 100; i++) {
+      results[index].push_back(static_cast<int>(index) * i);
+    }
+  });
+
+  for (size_t index = 0; index < results.size(); index++) {
+    ASSERT_EQ(results[index].size(), 100);
+    for (int i = 0; i < 100; i++) {
+      EXPECT_EQ(results[index][i], static_cast<int>(index) * i);
+    }
+  }
+}
+
+TEST(DiffArenaTest, smallVectorKeepsShortListsInline) {
+  auto arena = DiffArena{};
+  auto vector = DiffArenaSmallVector<int, 4>(DiffArenaAllocator<int>{&arena});
+  for (int i = 0; i < 4; i++) {
+    vector.push_back(i);
+  }
+  EXPECT_EQ(arena.getCapacity(), 0);
+
+  vector.push_back(4);
+  EXPECT_GT(arena.getCapacity(), 0);
+
+  ASSERT_EQ(vector.size(), 5);
+  for (int i = 0; i < 5; i++) {
+    EXPECT_EQ(vector[i], i);
+  }
+}
+
+TEST(DiffArenaTest, smallVectorWithoutArenaUsesHeap) {
+  auto inlineVector = DiffArenaSmallVector<int, 4>{};
+  inlineVector.push_back(1);
+
+  auto heapVector = DiffArenaSmallVector<int, 4>{};
+  for (int i = 0; i < 100; i++) {
+    heapVector.push_back(i);
+  }
+
+  // Moving takes over the heap storage and copies the inline one.
+  auto movedInlineVector = std::move(inlineVector);
+  auto movedHeapVector = std::move(heapVector);
+  EXPECT_TRUE(inlineVector.empty());
+  EXPECT_TRUE(heapVector.empty());
+  ASSERT_EQ(movedInlineVector.size(), 1);
+  EXPECT_EQ(movedInlineVector[0], 1);
+  ASSERT_EQ(movedHeapVector.size(), 100);
+  EXPECT_EQ(movedHeapVector.back(), 99);
+
+  auto copiedVector = movedHeapVector;
+  EXPECT_TRUE(std::equal(
+      copiedVector.begin(),
+      copiedVector.end(),
+      movedHeapVector.begin(),
+      movedHeapVector.end()));
+}
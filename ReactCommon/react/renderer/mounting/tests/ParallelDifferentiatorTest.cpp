@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <atomic>
+#include <vector>
+
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/mounting/DiffWorkPool.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/ShadowViewMutation.h>
+
+#include <react/renderer/mounting/stubs.h>
+#include <react/test_utils/Entropy.h>
+#include <react/test_utils/shadowTreeGeneration.h>
+
+namespace facebook {
+namespace react {
+
+static void expectMutationListsEqual(
+    ShadowViewMutation::List const &serialMutations,
+    ShadowViewMutation::List const &parallelMutations) {
+  ASSERT_EQ(serialMutations.size(), parallelMutations.size());
+
+  for (size_t i = 0; i < serialMutations.size(); i++) {
+    auto const &lhs = serialMutations[i];
+    auto const &rhs = parallelMutations[i];
+    EXPECT_EQ(lhs.type, rhs.type) << "Mutation #" << i;
+    EXPECT_EQ(lhs.index, rhs.index) << "Mutation #" << i;
+    EXPECT_TRUE(lhs.parentShadowView == rhs.parentShadowView)
+        << "Mutation #" << i;
+    EXPECT_TRUE(lhs.oldChildShadowView == rhs.oldChildShadowView)
+        << "Mutation #" << i;
+    EXPECT_TRUE(lhs.newChildShadowView == rhs.newChildShadowView)
+        << "Mutation #" << i;
+  }
+}
+
+static void testParallelDiffingDeterminism(
+    uint_fast32_t seed,
+    int treeSize,
+    int repeats,
+    int stages) {
+  auto entropy = seed == 0 ? Entropy() : Entropy(seed);
+
+  auto eventDispatcher = EventDispatcher::Shared{};
+  auto contextContainer = std::make_shared<ContextContainer>();
+  auto componentDescriptorParameters =
+      ComponentDescriptorParameters{eventDispatcher, contextContainer, nullptr};
+  auto viewComponentDescriptor =
+      ViewComponentDescriptor(componentDescriptorParameters);
+  auto rootComponentDescriptor =
+      RootComponentDescriptor(componentDescriptorParameters);
+
+  PropsParserContext parserContext{-1, *contextContainer};
+
+  auto workPool = DiffWorkPool(4);
+
+  for (int i = 0; i < repeats; i++) {
+    auto family = rootComponentDescriptor.createFamily(
+        {Tag(1), SurfaceId(1), nullptr}, nullptr);
+
+    // Creating an initial root shadow node.
+    auto emptyRootNode = std::const_pointer_cast<RootShadowNode>(
+        std::static_pointer_cast<RootShadowNode const>(
+            rootComponentDescriptor.createShadowNode(
+                ShadowNodeFragment{RootShadowNode::defaultSharedProps()},
+                family)));
+
+    // Applying size constraints.
+    emptyRootNode = emptyRootNode->clone(
+        parserContext,
+        LayoutConstraints{
+            Size{512, 0}, Size{512, std::numeric_limits<Float>::infinity()}},
+        LayoutContext{});
+
+    // Generation of a random tree.
+    auto singleRootChildNode =
+        generateShadowNodeTree(entropy, viewComponentDescriptor, treeSize);
+
+    // Injecting a tree into the root node.
+    auto currentRootNode = std::static_pointer_cast<RootShadowNode const>(
+        emptyRootNode->ShadowNode::clone(ShadowNodeFragment{
+            ShadowNodeFragment::propsPlaceholder(),
+            std::make_shared<SharedShadowNodeList>(
+                SharedShadowNodeList{singleRootChildNode})}));
+
+    expectMutationListsEqual(
+        calculateShadowViewMutations(*emptyRootNode, *currentRootNode),
+        calculateShadowViewMutations(
+            *emptyRootNode, *currentRootNode, &workPool));
+
+    auto viewTree = buildStubViewTreeWithoutUsingDifferentiator(*emptyRootNode);
+    viewTree.mutate(
+        calculateShadowViewMutations(*emptyRootNode, *currentRootNode));
+
+    for (int j = 0; j < stages; j++) {
+      auto nextRootNode = currentRootNode;
+
+      // Mutating the tree, several times per stage to make sure that
+      // multiple sibling subtrees are changed at once.
+      for (int k = 0; k < 8; k++) {
+        alterShadowTree(
+            entropy,
+            nextRootNode,
+            {
+                &messWithChildren,
+                &messWithYogaStyles,
+                &messWithLayoutableOnlyFlag,
+                &messWithNodeFlattenednessFlags,
+            });
+      }
+
+      std::vector<LayoutableShadowNode const *> affectedLayoutableNodes{};
+      affectedLayoutableNodes.reserve(1024);
+
+      // Laying out the tree.
+      std::const_pointer_cast<RootShadowNode>(nextRootNode)
+          ->layoutIfNeeded(&affectedLayoutableNodes);
+
+      nextRootNode->sealRecursive();
+
+      auto serialMutations =
+          calculateShadowViewMutations(*currentRootNode, *nextRootNode);
+      auto parallelMutations = calculateShadowViewMutations(
+          *currentRootNode, *nextRootNode, &workPool);
+
+      expectMutationListsEqual(serialMutations, parallelMutations);
+
+      // The parallel mutations must be valid on their own.
+      viewTree.mutate(parallelMutations);
+      EXPECT_TRUE(
+          viewTree ==
+          buildStubViewTreeWithoutUsingDifferentiator(*nextRootNode));
+
+      currentRootNode = nextRootNode;
+    }
+  }
+}
+
+} // namespace react
+} // namespace facebook
+
+using namespace facebook::react;
+
+TEST(ParallelDifferentiatorTest, singleThreadedPoolRunsInline) {
+  auto workPool = DiffWorkPool(1);
+  EXPECT_EQ(workPool.getConcurrency(), size_t{1});
+
+  auto visited = std::vector<int>{};
+  workPool.parallelFor(5, [&](size_t index) {
+    visited.push_back(static_cast<int>(index));
+  });
+
+  EXPECT_EQ(visited, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST(ParallelDifferentiatorTest, parallelForVisitsEveryIndexOnce) {
+  auto workPool = DiffWorkPool(4);
+  auto counters = std::vector<std::atomic<int>>(1000);
+
+  workPool.parallelFor(counters.size(), [&](size_t index) {
+    // Nested batches must not deadlock.
+    workPool.parallelFor(
+        3, [&](size_t /*nestedIndex*/) { counters[index].fetch_add(1); });
+  });
+
+  for (auto const &counter : counters) {
+    EXPECT_EQ(counter.load(), 3);
+  }
+}
+
+TEST(
+    ParallelDifferentiatorTest,
+    parallelMutationsMatchSerialMutations_Small) {
+  testParallelDiffingDeterminism(
+      /* seed */ 1,
+      /* size */ 64,
+      /* repeats */ 32,
+      /* stages */ 16);
+}
+
+TEST(
+    ParallelDifferentiatorTest,
+    parallelMutationsMatchSerialMutations_Large) {
+  testParallelDiffingDeterminism(
+      /* seed */ 2,
+      /* size */ 1024,
+      /* repeats */ 8,
+      /* stages */ 16);
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+
+#include <react/renderer/element/testUtils.h>
+
+using namespace facebook::react;
+
+class CountingShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      ShadowTree const &shadowTree,
+      RootShadowNode::Shared const &oldRootShadowNode,
+      RootShadowNode::Unshared const &newRootShadowNode) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      ShadowTree const &shadowTree,
+      MountingCoordinator::Shared const &mountingCoordinator) const override {
+    numberOfMounts++;
+  };
+
+  mutable std::atomic<int> numberOfMounts{0};
+};
+
+/*
+ * Returns a transaction that appends the given node to the root.
+ */
+static ShadowTreeCommitTransaction makeAppendTransaction(
+    ShadowNode::Shared const &childShadowNode) {
+  return [=](RootShadowNode const &oldRootShadowNode) {
+    auto children = std::make_shared<ShadowNode::ListOfShared>(
+        oldRootShadowNode.getChildren());
+    children->push_back(childShadowNode);
+    return std::make_shared<RootShadowNode>(
+        oldRootShadowNode,
+        ShadowNodeFragment{
+            /* .props = */ ShadowNodeFragment::propsPlaceholder(),
+            /* .children = */ children,
+        });
+  };
+}
+
+class ShadowTreeCommitQueueTest : public ::testing::Test {
+ protected:
+  ShadowTreeCommitQueueTest() : builder_(simpleComponentBuilder()) {
+    shadowTree_ = std::make_unique<ShadowTree>(
+        SurfaceId{11},
+        LayoutConstraints{},
+        LayoutContext{},
+        delegate_,
+        contextContainer_);
+    shadowTree_->setCommitQueueEnabled(true);
+  }
+
+  ShadowNode::Shared makeViewShadowNode(Tag tag) {
+    // clang-format off
+    auto element =
+        Element<ViewShadowNode>()
+          .tag(tag)
+          .surfaceId(11);
+    // clang-format on
+    return builder_.build(element);
+  }
+
+  ComponentBuilder builder_;
+  ContextContainer contextContainer_{};
+  CountingShadowTreeDelegate delegate_{};
+  std::unique_ptr<ShadowTree> shadowTree_;
+};
+
+TEST_F(ShadowTreeCommitQueueTest, sequentialCommits) {
+  for (int i = 0; i < 4; i++) {
+    auto status =
+        shadowTree_->commit(makeAppendTransaction(makeViewShadowNode(2 + i)));
+    EXPECT_EQ(status, ShadowTree::CommitStatus::Succeeded);
+  }
+
+  auto revision = shadowTree_->getCurrentRevision();
+  EXPECT_EQ(revision.number, 4);
+  EXPECT_EQ(revision.rootShadowNode->getChildren().size(), size_t{4});
+  EXPECT_EQ(revision.telemetry.getNumberOfMergedTransactions(), 1);
+  EXPECT_EQ(revision.telemetry.getNumberOfCommitRetries(), 0);
+  EXPECT_EQ(delegate_.numberOfMounts, 4);
+
+  // Cancelled transactions do not produce revisions.
+  auto status = shadowTree_->commit(
+      [](RootShadowNode const &) { return RootShadowNode::Unshared{}; });
+  EXPECT_EQ(status, ShadowTree::CommitStatus::Cancelled);
+  EXPECT_EQ(shadowTree_->getCurrentRevision().number, 4);
+}
+
+TEST_F(ShadowTreeCommitQueueTest, concurrentCommitsAreMerged) {
+  auto viewShadowNodeA = makeViewShadowNode(2);
+  auto viewShadowNodeB = makeViewShadowNode(3);
+  auto viewShadowNodeC = makeViewShadowNode(4);
+
+  auto threads = std::vector<std::thread>{};
+  auto statusB = ShadowTree::CommitStatus::Failed;
+  auto statusC = ShadowTree::CommitStatus::Failed;
+
+  // While the first transaction is being applied, two more are issued from
+  // other threads; they have to wait and end up in the same revision.
+  auto appendA = makeAppendTransaction(viewShadowNodeA);
+  auto statusA =
+      shadowTree_->commit([&](RootShadowNode const &oldRootShadowNode) {
+        threads.emplace_back([&]() {
+          statusB =
+              shadowTree_->commit(makeAppendTransaction(viewShadowNodeB));
+        });
+        threads.emplace_back([&]() {
+          statusC =
+              shadowTree_->commit(makeAppendTransaction(viewShadowNodeC));
+        });
+        shadowTree_->waitForQueuedCommits(2);
+        return appendA(oldRootShadowNode);
+      });
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(statusA, ShadowTree::CommitStatus::Succeeded);
+  EXPECT_EQ(statusB, ShadowTree::CommitStatus::Succeeded);
+  EXPECT_EQ(statusC, ShadowTree::CommitStatus::Succeeded);
+
+  auto revision = shadowTree_->getCurrentRevision();
+  EXPECT_EQ(revision.number, 2);
+  EXPECT_EQ(revision.rootShadowNode->getChildren().size(), size_t{3});
+  EXPECT_EQ(revision.telemetry.getNumberOfMergedTransactions(), 2);
+  EXPECT_EQ(delegate_.numberOfMounts, 2);
+}
+
+TEST_F(ShadowTreeCommitQueueTest, manyConcurrentCommits) {
+  constexpr int kNumberOfThreads = 8;
+  constexpr int kNumberOfCommitsPerThread = 16;
+
+  auto threads = std::vector<std::thread>{};
+  auto numberOfSucceededCommits = std::atomic<int>{0};
+
+  for (int i = 0; i < kNumberOfThreads; i++) {
+    auto viewShadowNodes = std::vector<ShadowNode::Shared>{};
+    for (int j = 0; j < kNumberOfCommitsPerThread; j++) {
+      viewShadowNodes.push_back(
+          makeViewShadowNode(2 + i * kNumberOfCommitsPerThread + j));
+    }
+
+    threads.emplace_back([&, viewShadowNodes]() {
+      for (auto const &viewShadowNode : viewShadowNodes) {
+        auto status =
+            shadowTree_->commit(makeAppendTransaction(viewShadowNode));
+        if (status == ShadowTree::CommitStatus::Succeeded) {
+          numberOfSucceededCommits++;
+        }
+      }
+    });
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  auto revision = shadowTree_->getCurrentRevision();
+  EXPECT_EQ(
+      numberOfSucceededCommits, kNumberOfThreads * kNumberOfCommitsPerThread);
+  EXPECT_EQ(
+      revision.rootShadowNode->getChildren().size(),
+      size_t{kNumberOfThreads * kNumberOfCommitsPerThread});
+  EXPECT_EQ(delegate_.numberOfMounts, static_cast<int>(revision.number));
+  EXPECT_LE(revision.number, kNumberOfThreads * kNumberOfCommitsPerThread);
+}
+
+TEST_F(ShadowTreeCommitQueueTest, exceptionsAreRethrownToTheCaller) {
+  auto throwingTransaction =
+      [](RootShadowNode const &) -> RootShadowNode::Unshared {
+    throw std::runtime_error("Transaction failed.");
+  };
+  EXPECT_THROW(shadowTree_->commit(throwingTransaction), std::runtime_error);
+
+  // The queue is not stuck.
+  auto status =
+      shadowTree_->commit(makeAppendTransaction(makeViewShadowNode(2)));
+  EXPECT_EQ(status, ShadowTree::CommitStatus::Succeeded);
+  EXPECT_EQ(shadowTree_->getCurrentRevision().number, 1);
+}
@@ -106,6 +106,9 @@ static void testShadowNodeTreeLifeCycle(
           ->layoutIfNeeded(&affectedLayoutableNodes);
 
       nextRootNode->sealRecursive();
+      // Same as `ShadowTree::tryCommit`: lets the differ skip subtrees that
+      // were cloned without mount-relevant changes.
+      nextRootNode->stampMountGenerationRecursive();
       allNodes.push_back(nextRootNode);
 
       // Calculating mutations.
@@ -257,6 +260,9 @@ static void testShadowNodeTreeLifeCycleExtensiveFlatteningUnflattening(
           ->layoutIfNeeded(&affectedLayoutableNodes);
 
       nextRootNode->sealRecursive();
+      // Same as `ShadowTree::tryCommit`: lets the differ skip subtrees that
+      // were cloned without mount-relevant changes.
+      nextRootNode->stampMountGenerationRecursive();
       allNodes.push_back(nextRootNode);
 
       // Calculating mutations.
@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <vector>
+
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/ShadowViewMutationCompaction.h>
+
+#include <react/renderer/mounting/stubs.h>
+#include <react/test_utils/Entropy.h>
+#include <react/test_utils/shadowTreeGeneration.h>
+
+namespace facebook {
+namespace react {
+
+static ShadowView makeShadowView(Tag tag, int revision = 0) {
+  auto shadowView = ShadowView{};
+  shadowView.tag = tag;
+  shadowView.layoutMetrics.frame.origin.x = revision;
+  return shadowView;
+}
+
+static std::vector<ShadowViewMutation::Type> getMutationTypes(
+    ShadowViewMutation::List const &mutations) {
+  auto types = std::vector<ShadowViewMutation::Type>{};
+  for (auto const &mutation : mutations) {
+    types.push_back(mutation.type);
+  }
+  return types;
+}
+
+/*
+ * Simulates a `MountingCoordinator` that fell behind: the mutations of
+ * several consecutive revisions are concatenated and compacted, and the
+ * result must still bring the stub view tree to the latest revision.
+ */
+static void testCompactionOfCoalescedRevisions(
+    uint_fast32_t seed,
+    int treeSize,
+    int repeats,
+    int stages,
+    int revisionsPerTransaction) {
+  auto entropy = seed == 0 ? Entropy() : Entropy(seed);
+
+  auto eventDispatcher = EventDispatcher::Shared{};
+  auto contextContainer = std::make_shared<ContextContainer>();
+  auto componentDescriptorParameters =
+      ComponentDescriptorParameters{eventDispatcher, contextContainer, nullptr};
+  auto viewComponentDescriptor =
+      ViewComponentDescriptor(componentDescriptorParameters);
+  auto rootComponentDescriptor =
+      RootComponentDescriptor(componentDescriptorParameters);
+
+  PropsParserContext parserContext{-1, *contextContainer};
+
+  auto numberOfMutations = size_t{0};
+  auto numberOfDroppedMutations = size_t{0};
+
+  for (int i = 0; i < repeats; i++) {
+    auto family = rootComponentDescriptor.createFamily(
+        {Tag(1), SurfaceId(1), nullptr}, nullptr);
+
+    // Creating an initial root shadow node.
+    auto emptyRootNode = std::const_pointer_cast<RootShadowNode>(
+        std::static_pointer_cast<RootShadowNode const>(
+            rootComponentDescriptor.createShadowNode(
+                ShadowNodeFragment{RootShadowNode::defaultSharedProps()},
+                family)));
+
+    // Applying size constraints.
+    emptyRootNode = emptyRootNode->clone(
+        parserContext,
+        LayoutConstraints{
+            Size{512, 0}, Size{512, std::numeric_limits<Float>::infinity()}},
+        LayoutContext{});
+
+    // Generation of a random tree.
+    auto singleRootChildNode =
+        generateShadowNodeTree(entropy, viewComponentDescriptor, treeSize);
+
+    // Injecting a tree into the root node.
+    auto currentRootNode = std::static_pointer_cast<RootShadowNode const>(
+        emptyRootNode->ShadowNode::clone(ShadowNodeFragment{
+            ShadowNodeFragment::propsPlaceholder(),
+            std::make_shared<SharedShadowNodeList>(
+                SharedShadowNodeList{singleRootChildNode})}));
+
+    auto viewTree = buildStubViewTreeWithoutUsingDifferentiator(*emptyRootNode);
+    viewTree.mutate(
+        calculateShadowViewMutations(*emptyRootNode, *currentRootNode));
+
+    for (int j = 0; j < stages; j++) {
+      auto mutations = ShadowViewMutation::List{};
+
+      for (int k = 0; k < revisionsPerTransaction; k++) {
+        auto nextRootNode = currentRootNode;
+
+        alterShadowTree(
+            entropy,
+            nextRootNode,
+            {
+                &messWithChildren,
+                &messWithYogaStyles,
+                &messWithLayoutableOnlyFlag,
+                &messWithNodeFlattenednessFlags,
+            });
+
+        std::vector<LayoutableShadowNode const *> affectedLayoutableNodes{};
+        affectedLayoutableNodes.reserve(1024);
+
+        // Laying out the tree.
+        std::const_pointer_cast<RootShadowNode>(nextRootNode)
+            ->layoutIfNeeded(&affectedLayoutableNodes);
+
+        nextRootNode->sealRecursive();
+
+        auto revisionMutations =
+            calculateShadowViewMutations(*currentRootNode, *nextRootNode);
+        mutations.insert(
+            mutations.end(),
+            revisionMutations.begin(),
+            revisionMutations.end());
+
+        currentRootNode = nextRootNode;
+      }
+
+      numberOfMutations += mutations.size();
+      auto numberOfDroppedMutationsBefore = numberOfDroppedMutations;
+      auto expectedSize = mutations.size();
+
+      numberOfDroppedMutations += compactShadowViewMutations(mutations);
+      EXPECT_EQ(
+          mutations.size(),
+          expectedSize -
+              (numberOfDroppedMutations - numberOfDroppedMutationsBefore));
+
+      viewTree.mutate(mutations);
+      EXPECT_TRUE(
+          viewTree ==
+          buildStubViewTreeWithoutUsingDifferentiator(*currentRootNode));
+    }
+  }
+
+  // Later revisions undo and redo a fair amount of earlier work.
+  EXPECT_GT(numberOfDroppedMutations, size_t{0});
+  LOG(ERROR) << "Compaction dropped " << numberOfDroppedMutations << " of "
+             << numberOfMutations << " mutations.";
+}
+
+} // namespace react
+} // namespace facebook
+
+using namespace facebook::react;
+
+TEST(ShadowViewMutationCompactionTest, transientViewsAreDropped) {
+  auto parentShadowView = makeShadowView(1);
+
+  auto mutations = ShadowViewMutation::List{
+      ShadowViewMutation::CreateMutation(makeShadowView(3)),
+      ShadowViewMutation::UpdateMutation(
+          makeShadowView(3), makeShadowView(3, 1)),
+      ShadowViewMutation::InsertMutation(
+          parentShadowView, makeShadowView(3, 1), 0),
+      ShadowViewMutation::RemoveMutation(
+          parentShadowView, makeShadowView(3, 1), 0),
+      ShadowViewMutation::DeleteMutation(makeShadowView(3, 1)),
+  };
+
+  // The view is never observed.
+  EXPECT_EQ(compactShadowViewMutations(mutations), size_t{5});
+  EXPECT_TRUE(mutations.empty());
+}
+
+TEST(ShadowViewMutationCompactionTest, observedViewsAreKept) {
+  auto parentShadowView = makeShadowView(1);
+  auto siblingShadowView = makeShadowView(2);
+  auto childShadowView = makeShadowView(3);
+
+  // The sibling shifts the index of the view while it is inserted.
+  auto mutations = ShadowViewMutation::List{
+      ShadowViewMutation::CreateMutation(childShadowView),
+      ShadowViewMutation::InsertMutation(parentShadowView, childShadowView, 0),
+      ShadowViewMutation::InsertMutation(
+          parentShadowView, siblingShadowView, 0),
+      ShadowViewMutation::RemoveMutation(
+          parentShadowView, siblingShadowView, 0),
+      ShadowViewMutation::RemoveMutation(parentShadowView, childShadowView, 0),
+      ShadowViewMutation::DeleteMutation(childShadowView),
+  };
+
+  EXPECT_EQ(compactShadowViewMutations(mutations), size_t{0});
+  EXPECT_EQ(mutations.size(), size_t{6});
+
+  // The view becomes a parent.
+  mutations = ShadowViewMutation::List{
+      ShadowViewMutation::CreateMutation(parentShadowView),
+      ShadowViewMutation::InsertMutation(parentShadowView, childShadowView, 0),
+      ShadowViewMutation::RemoveMutation(parentShadowView, childShadowView, 0),
+      ShadowViewMutation::DeleteMutation(parentShadowView),
+  };
+
+  EXPECT_EQ(compactShadowViewMutations(mutations), size_t{0});
+  EXPECT_EQ(
+      getMutationTypes(mutations),
+      (std::vector<ShadowViewMutation::Type>{
+          ShadowViewMutation::Create,
+          ShadowViewMutation::Insert,
+          ShadowViewMutation::Remove,
+          ShadowViewMutation::Delete,
+      }));
+}
+
+TEST(ShadowViewMutationCompactionTest, updatesAreMerged) {
+  auto mutations = ShadowViewMutation::List{
+      ShadowViewMutation::UpdateMutation(
+          makeShadowView(2), makeShadowView(2, 1)),
+      ShadowViewMutation::UpdateMutation(
+          makeShadowView(3), makeShadowView(3, 1)),
+      ShadowViewMutation::UpdateMutation(
+          makeShadowView(2, 1), makeShadowView(2, 2)),
+      ShadowViewMutation::UpdateMutation(
+          makeShadowView(3, 1), makeShadowView(3)),
+  };
+
+  EXPECT_EQ(compactShadowViewMutations(mutations), size_t{3});
+  ASSERT_EQ(mutations.size(), size_t{1});
+  EXPECT_EQ(mutations[0].type, ShadowViewMutation::Update);
+  EXPECT_TRUE(mutations[0].oldChildShadowView == makeShadowView(2));
+  EXPECT_TRUE(mutations[0].newChildShadowView == makeShadowView(2, 2));
+}
+
+TEST(ShadowViewMutationCompactionTest, updatesAreFoldedIntoCreate) {
+  auto mutations = ShadowViewMutation::List{
+      ShadowViewMutation::CreateMutation(makeShadowView(2)),
+      ShadowViewMutation::UpdateMutation(
+          makeShadowView(2), makeShadowView(2, 1)),
+      ShadowViewMutation::InsertMutation(
+          makeShadowView(1), makeShadowView(2, 1), 0),
+  };
+
+  EXPECT_EQ(compactShadowViewMutations(mutations), size_t{1});
+  ASSERT_EQ(mutations.size(), size_t{2});
+  EXPECT_EQ(mutations[0].type, ShadowViewMutation::Create);
+  EXPECT_TRUE(mutations[0].newChildShadowView == makeShadowView(2, 1));
+}
+
+TEST(ShadowViewMutationCompactionTest, reinsertionsAreDroppedOrUpdated) {
+  auto parentShadowView = makeShadowView(1);
+
+  auto mutations = ShadowViewMutation::List{
+      ShadowViewMutation::RemoveMutation(
+          parentShadowView, makeShadowView(3), 1),
+      ShadowViewMutation::RemoveMutation(
+          parentShadowView, makeShadowView(2), 0),
+      ShadowViewMutation::InsertMutation(
+          parentShadowView, makeShadowView(3, 1), 1),
+  };
+
+  // The second `Remove` shifts the indices; the view is actually moved.
+  EXPECT_EQ(compactShadowViewMutations(mutations), size_t{0});
+
+  mutations = ShadowViewMutation::List{
+      ShadowViewMutation::RemoveMutation(
+          parentShadowView, makeShadowView(2), 0),
+      ShadowViewMutation::InsertMutation(
+          parentShadowView, makeShadowView(2), 0),
+      ShadowViewMutation::RemoveMutation(
+          parentShadowView, makeShadowView(3), 1),
+      ShadowViewMutation::InsertMutation(
+          parentShadowView, makeShadowView(3, 1), 1),
+  };
+
+  EXPECT_EQ(compactShadowViewMutations(mutations), size_t{3});
+  ASSERT_EQ(mutations.size(), size_t{1});
+  EXPECT_EQ(mutations[0].type, ShadowViewMutation::Update);
+  EXPECT_TRUE(mutations[0].oldChildShadowView == makeShadowView(3));
+  EXPECT_TRUE(mutations[0].newChildShadowView == makeShadowView(3, 1));
+}
+
+TEST(ShadowViewMutationCompactionTest, coalescedRevisionsStayValid) {
+  testCompactionOfCoalescedRevisions(
+      /* seed */ 1,
+      /* size */ 256,
+      /* repeats */ 8,
+      /* stages */ 8,
+      /* revisions per transaction */ 4);
+}
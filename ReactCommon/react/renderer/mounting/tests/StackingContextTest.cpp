@@ -255,8 +255,8 @@ TEST_F(StackingContextTest, mostPropsDoNotForceViewsToMaterialize) {
     yogaStyle.padding()[YGEdgeAll] = YGValue{42, YGUnitPoint};
     yogaStyle.margin()[YGEdgeAll] = YGValue{42, YGUnitPoint};
     yogaStyle.positionType() = YGPositionTypeAbsolute;
-    props.shadowRadius = 42;
-    props.shadowOffset = Size{42, 42};
+    props.mutableColdProps().shadowRadius = 42;
+    props.mutableColdProps().shadowOffset = Size{42, 42};
     props.backgroundColor = clearColor();
   });
 
@@ -264,21 +264,21 @@ TEST_F(StackingContextTest, mostPropsDoNotForceViewsToMaterialize) {
     auto &yogaStyle = props.yogaStyle;
     props.zIndex = 42;
     yogaStyle.margin()[YGEdgeAll] = YGValue{42, YGUnitPoint};
-    props.shadowColor = clearColor();
-    props.shadowOpacity = 0.42;
+    props.mutableColdProps().shadowColor = clearColor();
+    props.mutableColdProps().shadowOpacity = 0.42;
   });
 
   mutateViewShadowNodeProps_(nodeBBA_, [](ViewProps &props) {
     auto &yogaStyle = props.yogaStyle;
     yogaStyle.positionType() = YGPositionTypeRelative;
 
-    props.borderRadii.all = 42;
-    props.borderColors.all = blackColor();
+    props.mutableColdProps().borderRadii.all = 42;
+    props.mutableColdProps().borderColors.all = blackColor();
   });
 
   mutateViewShadowNodeProps_(nodeBD_, [](ViewProps &props) {
     props.onLayout = true;
-    props.hitSlop = EdgeInsets{42, 42, 42, 42};
+    props.mutableColdProps().hitSlop = EdgeInsets{42, 42, 42, 42};
   });
 
   testViewTree_([](StubViewTree const &viewTree) {
@@ -357,8 +357,9 @@ TEST_F(StackingContextTest, somePropsForceViewsToMaterialize1) {
   mutateViewShadowNodeProps_(
       nodeBA_, [](ViewProps &props) { props.backgroundColor = whiteColor(); });
 
-  mutateViewShadowNodeProps_(
-      nodeBBA_, [](ViewProps &props) { props.shadowColor = blackColor(); });
+  mutateViewShadowNodeProps_(nodeBBA_, [](ViewProps &props) {
+    props.mutableColdProps().shadowColor = blackColor();
+  });
 
   testViewTree_([](StubViewTree const &viewTree) {
     // 4 views in total.
@@ -461,8 +462,9 @@ TEST_F(StackingContextTest, somePropsForceViewsToMaterialize2) {
     props.zIndex = 42;
   });
 
-  mutateViewShadowNodeProps_(
-      nodeBC_, [](ViewProps &props) { props.shadowColor = blackColor(); });
+  mutateViewShadowNodeProps_(nodeBC_, [](ViewProps &props) {
+    props.mutableColdProps().shadowColor = blackColor();
+  });
 
   mutateViewShadowNodeProps_(
       nodeBD_, [](ViewProps &props) { props.opacity = 0.42; });
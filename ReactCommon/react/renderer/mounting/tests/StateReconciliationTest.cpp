@@ -5,6 +5,7 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <algorithm>
 #include <memory>
 
 #include <gtest/gtest.h>
@@ -141,6 +142,14 @@ TEST(StateReconciliationTest, testStateReconciliation) {
   EXPECT_EQ(state1->getMostRecentState(), state2);
   EXPECT_EQ(state2->getMostRecentState(), state2);
 
+  // Only families with obsolete states are visited by the reconciliation.
+  auto families = ShadowNodeFamily::getFamiliesWithObsoleteStates(
+      shadowNodeAB->getSurfaceId());
+  EXPECT_TRUE(std::any_of(
+      families.begin(), families.end(), [&](auto const &obsoleteFamily) {
+        return obsoleteFamily.get() == &family;
+      }));
+
   auto state3 = scrollViewComponentDescriptor.createState(
       family, std::make_shared<ScrollViewState const>());
 
@@ -178,3 +187,78 @@ TEST(StateReconciliationTest, testStateReconciliation) {
 
   EXPECT_EQ(findDescendantNode(shadowTree, family)->getState(), state3);
 }
+
+TEST(StateReconciliationTest, testFamilyIsDrainedWhenObsoleteStatesAreGone) {
+  auto builder = simpleComponentBuilder();
+
+  auto shadowNodeAB = std::shared_ptr<ScrollViewShadowNode>{};
+
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .finalize([](RootShadowNode &shadowNode){
+          shadowNode.sealRecursive();
+        })
+        .children({
+          Element<ScrollViewShadowNode>()
+            .reference(shadowNodeAB)
+        });
+  // clang-format on
+
+  ContextContainer contextContainer{};
+
+  auto shadowNode = builder.build(element);
+
+  auto &scrollViewComponentDescriptor = shadowNodeAB->getComponentDescriptor();
+  auto &family = shadowNodeAB->getFamily();
+  auto surfaceId = shadowNodeAB->getSurfaceId();
+  auto shadowTreeDelegate = DummyShadowTreeDelegate{};
+  ShadowTree shadowTree{
+      SurfaceId{11},
+      LayoutConstraints{},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer};
+
+  auto isRegistered = [&]() {
+    auto families = ShadowNodeFamily::getFamiliesWithObsoleteStates(surfaceId);
+    return std::any_of(
+        families.begin(), families.end(), [&](auto const &obsoleteFamily) {
+          return obsoleteFamily.get() == &family;
+        });
+  };
+
+  shadowTree.commit(
+      [&](RootShadowNode const &oldRootShadowNode) {
+        return std::static_pointer_cast<RootShadowNode>(shadowNode);
+      },
+      {true});
+
+  // Committing the initial state does not make any state obsolete.
+  EXPECT_FALSE(isRegistered());
+
+  auto rootShadowNodeState2 =
+      shadowNode->cloneTree(family, [&](ShadowNode const &oldShadowNode) {
+        return oldShadowNode.clone(
+            {ShadowNodeFragment::propsPlaceholder(),
+             ShadowNodeFragment::childrenPlaceholder(),
+             scrollViewComponentDescriptor.createState(
+                 family, std::make_shared<ScrollViewState const>())});
+      });
+
+  shadowTree.commit(
+      [&](RootShadowNode const &oldRootShadowNode) {
+        return std::static_pointer_cast<RootShadowNode>(rootShadowNodeState2);
+      },
+      {true});
+
+  // The old tree still carries the obsolete state and can be committed again,
+  // so reading the registry does not drain the family.
+  EXPECT_TRUE(isRegistered());
+  EXPECT_TRUE(isRegistered());
+
+  // Once the obsolete state is deallocated, no node can carry it anymore.
+  shadowNode.reset();
+  shadowNodeAB.reset();
+  EXPECT_FALSE(isRegistered());
+}
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/mounting/CompactShadowViewMutationList.h>
+#include <react/renderer/mounting/DiffArena.h>
+#include <react/renderer/mounting/DiffWorkPool.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/utils/ContextContainer.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+
+/*
+ * Counts the bytes which are currently allocated through the global
+ * `operator new` so memory counters include everything a data structure
+ * retains (e.g. hash table buckets and nodes), not only what its public
+ * accessors expose.
+ */
+static std::atomic<size_t> liveHeapBytes{0};
+
+// Keeps allocations aligned for any fundamental type.
+constexpr static size_t kAllocationHeaderSize = alignof(std::max_align_t);
+
+void *operator new(size_t size) {
+  auto pointer = static_cast<char *>(std::malloc(size + kAllocationHeaderSize));
+  if (pointer == nullptr) {
+    throw std::bad_alloc{};
+  }
+  *reinterpret_cast<size_t *>(pointer) = size;
+  liveHeapBytes += size;
+  return pointer + kAllocationHeaderSize;
+}
+
+void operator delete(void *pointer) noexcept {
+  if (pointer == nullptr) {
+    return;
+  }
+  auto header = static_cast<char *>(pointer) - kAllocationHeaderSize;
+  liveHeapBytes -= *reinterpret_cast<size_t *>(header);
+  std::free(header);
+}
+
+void operator delete(void *pointer, size_t /*size*/) noexcept {
+  operator delete(pointer);
+}
+
+namespace facebook {
+namespace react {
+
+auto contextContainer = std::make_shared<ContextContainer const>();
+auto eventDispatcher = std::shared_ptr<EventDispatcher>{nullptr};
+auto componentDescriptorParameters =
+    ComponentDescriptorParameters{eventDispatcher, contextContainer, nullptr};
+auto viewComponentDescriptor =
+    ViewComponentDescriptor{componentDescriptorParameters};
+auto rootComponentDescriptor =
+    RootComponentDescriptor{componentDescriptorParameters};
+auto rootFamily = rootComponentDescriptor.createFamily(
+    {Tag(1), SurfaceId(1), nullptr},
+    nullptr);
+
+/*
+ * Props that prevent a view from being flattened; `revision` makes props of
+ * different generations distinguishable (and so forces `Update` mutations).
+ */
+static Props::Shared concreteViewProps(int revision) {
+  auto dynamic = folly::dynamic::object();
+  dynamic["nativeID"] = "row-" + std::to_string(revision);
+  dynamic["accessible"] = true;
+  dynamic["width"] = 100;
+  dynamic["height"] = 20;
+
+  PropsParserContext parserContext{-1, *contextContainer};
+  return viewComponentDescriptor.cloneProps(
+      parserContext, nullptr, RawProps{dynamic});
+}
+
+/*
+ * Generates a list-like tree: the root contains `rowCount` rows, each row is
+ * a small subtree of `cellsPerRow` cells with a label inside.
+ */
+static RootShadowNode::Shared generateListTree(
+    int rowCount,
+    int cellsPerRow,
+    int revision) {
+  auto props = concreteViewProps(revision);
+  auto tag = Tag{2};
+
+  auto makeNode = [&](ShadowNode::ListOfShared children) {
+    auto family = viewComponentDescriptor.createFamily(
+        {tag++, SurfaceId(1), nullptr}, nullptr);
+    return viewComponentDescriptor.createShadowNode(
+        ShadowNodeFragment{
+            props,
+            std::make_shared<ShadowNode::ListOfShared const>(
+                std::move(children))},
+        family);
+  };
+
+  auto rows = ShadowNode::ListOfShared{};
+  rows.reserve(rowCount);
+  for (int i = 0; i < rowCount; i++) {
+    auto cells = ShadowNode::ListOfShared{};
+    for (int j = 0; j < cellsPerRow; j++) {
+      cells.push_back(makeNode({makeNode({})}));
+    }
+    rows.push_back(makeNode(std::move(cells)));
+  }
+
+  return std::static_pointer_cast<RootShadowNode const>(
+      rootComponentDescriptor.createShadowNode(
+          ShadowNodeFragment{
+              RootShadowNode::defaultSharedProps(),
+              std::make_shared<ShadowNode::ListOfShared const>(
+                  ShadowNode::ListOfShared{makeNode(std::move(rows))})},
+          rootFamily));
+}
+
+/*
+ * Re-renders a list of 5,000 rows where every row changed. The argument is
+ * the number of threads used for diffing (`1` means serial diffing).
+ */
+static void largeListUpdate(benchmark::State &state) {
+  auto concurrency = static_cast<size_t>(state.range(0));
+  auto workPool = DiffWorkPool(concurrency);
+
+  auto oldTree = generateListTree(5000, 4, 0);
+  auto newTree = generateListTree(5000, 4, 1);
+
+  for (auto _ : state) {
+    auto mutations = calculateShadowViewMutations(
+        *oldTree, *newTree, concurrency > 1 ? &workPool : nullptr);
+    benchmark::DoNotOptimize(mutations);
+  }
+}
+BENCHMARK(largeListUpdate)
+    ->RangeMultiplier(2)
+    ->Range(1, std::max(1u, std::thread::hardware_concurrency()))
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+/*
+ * Same as `largeListUpdate`, but all temporary data structures of the diff
+ * are allocated from an arena which is reset after every diff (as
+ * `MountingCoordinator` does).
+ */
+static void largeListUpdateWithArena(benchmark::State &state) {
+  auto concurrency = static_cast<size_t>(state.range(0));
+  auto workPool = DiffWorkPool(concurrency);
+  auto arena = DiffArena(concurrency);
+
+  auto oldTree = generateListTree(5000, 4, 0);
+  auto newTree = generateListTree(5000, 4, 1);
+
+  for (auto _ : state) {
+    auto mutations = calculateShadowViewMutations(
+        *oldTree, *newTree, concurrency > 1 ? &workPool : nullptr, &arena);
+    arena.reset();
+    benchmark::DoNotOptimize(mutations);
+  }
+}
+BENCHMARK(largeListUpdateWithArena)
+    ->RangeMultiplier(2)
+    ->Range(1, std::max(1u, std::thread::hardware_concurrency()))
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+/*
+ * Returns the number of bytes retained by the value which `build` returns:
+ * its own size plus the heap memory that is still allocated once it is
+ * built.
+ */
+template <typename BuilderT>
+static size_t getRetainedBytes(BuilderT const &build) {
+  auto liveHeapBytesBefore = liveHeapBytes.load();
+  auto value = build();
+  auto retainedBytes =
+      sizeof(value) + liveHeapBytes.load() - liveHeapBytesBefore;
+  benchmark::DoNotOptimize(value);
+  return retainedBytes;
+}
+
+/*
+ * Reports the memory (in bytes) retained by both mutation list
+ * representations as benchmark counters. `ShadowView`s only hold references
+ * to props, state and event emitters which are owned by the shadow tree, so
+ * those are not attributed to the lists.
+ */
+static void reportMutationListMemory(
+    benchmark::State &state,
+    ShadowViewMutationList const &mutations) {
+  state.counters["mutations"] = static_cast<double>(mutations.size());
+  state.counters["listBytes"] = static_cast<double>(
+      getRetainedBytes([&]() { return ShadowViewMutationList{mutations}; }));
+  state.counters["compactBytes"] =
+      static_cast<double>(getRetainedBytes([&]() {
+        return CompactShadowViewMutationList{ShadowViewMutationList{mutations}};
+      }));
+}
+
+/*
+ * Measures building (from the differ's output) and destroying a mutation
+ * list in the regular and the compact encodings. The first argument selects
+ * the encoding (`0` is regular, `1` is compact), the second one the scenario
+ * (`0` is the initial mount of a 5,000-row list, `1` is an update of every
+ * row of it).
+ */
+static void mutationListRoundTrip(benchmark::State &state) {
+  auto isCompact = state.range(0) == 1;
+  auto isUpdate = state.range(1) == 1;
+
+  auto emptyTree = generateListTree(0, 0, 0);
+  auto oldTree = generateListTree(5000, 4, 0);
+  auto newTree = generateListTree(5000, 4, 1);
+
+  auto mutations = isUpdate
+      ? calculateShadowViewMutations(*oldTree, *newTree)
+      : calculateShadowViewMutations(*emptyTree, *oldTree);
+
+  for (auto _ : state) {
+    if (isCompact) {
+      auto compactMutations = CompactShadowViewMutationList{};
+      compactMutations.reserve(mutations.size());
+      for (auto const &mutation : mutations) {
+        compactMutations.push_back(mutation);
+      }
+      benchmark::DoNotOptimize(compactMutations);
+    } else {
+      auto listMutations = ShadowViewMutationList{mutations};
+      benchmark::DoNotOptimize(listMutations);
+    }
+  }
+
+  reportMutationListMemory(state, mutations);
+}
+BENCHMARK(mutationListRoundTrip)
+    ->ArgNames({"compact", "update"})
+    ->Args({0, 0})
+    ->Args({1, 0})
+    ->Args({0, 1})
+    ->Args({1, 1})
+    ->Unit(benchmark::kMillisecond);
+
+/*
+ * Measures iterating over all mutations (as `StubViewTree` or a platform
+ * mounting layer would) through the compatibility iterator of the compact
+ * encoding versus the direct compact accessors.
+ */
+static void compactMutationListIteration(benchmark::State &state) {
+  auto useCompatibilityIterator = state.range(0) == 1;
+
+  auto emptyTree = generateListTree(0, 0, 0);
+  auto tree = generateListTree(5000, 4, 0);
+  auto compactMutations = CompactShadowViewMutationList(
+      calculateShadowViewMutations(*emptyTree, *tree));
+
+  for (auto _ : state) {
+    auto tagSum = Tag{0};
+    if (useCompatibilityIterator) {
+      for (auto const &mutation : compactMutations) {
+        tagSum += mutation.newChildShadowView.tag;
+      }
+    } else {
+      for (size_t i = 0; i < compactMutations.size(); i++) {
+        tagSum += compactMutations.getCompactMutation(i).childTag;
+      }
+    }
+    benchmark::DoNotOptimize(tagSum);
+  }
+}
+BENCHMARK(compactMutationListIteration)
+    ->ArgNames({"compatibilityIterator"})
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/scrollview/ScrollViewComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/utils/ContextContainer.h>
+#include <memory>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+class StateReconciliationShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      ShadowTree const &shadowTree,
+      RootShadowNode::Shared const &oldRootShadowNode,
+      RootShadowNode::Unshared const &newRootShadowNode) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      ShadowTree const &shadowTree,
+      MountingCoordinator::Shared const &mountingCoordinator) const override{};
+};
+
+/*
+ * Commits a 10,000-node tree over and over again, as React does when it
+ * commits trees that do not have the most recent states of native components
+ * (e.g. scroll positions). The first argument enables state reconciliation,
+ * the second one is the number of scroll views in the tree whose states
+ * became stale.
+ */
+static void staleStateReconciliation(benchmark::State &state) {
+  auto isReconciliationEnabled = state.range(0) == 1;
+  auto numberOfStaleStates = static_cast<size_t>(state.range(1));
+
+  auto contextContainer = std::make_shared<ContextContainer const>();
+  auto componentDescriptorParameters = ComponentDescriptorParameters{
+      EventDispatcher::Shared{}, contextContainer, nullptr};
+  auto viewComponentDescriptor =
+      ViewComponentDescriptor{componentDescriptorParameters};
+  auto scrollViewComponentDescriptor =
+      ScrollViewComponentDescriptor{componentDescriptorParameters};
+
+  auto tag = Tag{2};
+  auto scrollViewFamilies = std::vector<ShadowNodeFamily::Shared>{};
+
+  auto makeViewNode = [&](ShadowNode::ListOfShared children) {
+    auto family = viewComponentDescriptor.createFamily(
+        {tag++, SurfaceId(1), nullptr}, nullptr);
+    return viewComponentDescriptor.createShadowNode(
+        ShadowNodeFragment{
+            ViewShadowNode::defaultSharedProps(),
+            std::make_shared<ShadowNode::ListOfShared const>(
+                std::move(children))},
+        family);
+  };
+
+  auto makeScrollViewNode = [&]() {
+    auto family = scrollViewComponentDescriptor.createFamily(
+        {tag++, SurfaceId(1), nullptr}, nullptr);
+    scrollViewFamilies.push_back(family);
+    auto props = ScrollViewShadowNode::defaultSharedProps();
+    return scrollViewComponentDescriptor.createShadowNode(
+        ShadowNodeFragment{
+            props,
+            ShadowNodeFragment::childrenPlaceholder(),
+            scrollViewComponentDescriptor.createInitialState(
+                ShadowNodeFragment{props}, family)},
+        family);
+  };
+
+  // 2,500 rows of 4 nodes; three of the rows contain a scroll view.
+  constexpr int kNumberOfRows = 2500;
+  auto rows = ShadowNode::ListOfShared{};
+  rows.reserve(kNumberOfRows);
+  for (int i = 0; i < kNumberOfRows; i++) {
+    auto isScrollViewRow = i % (kNumberOfRows / 3) == 1;
+    rows.push_back(makeViewNode({
+        makeViewNode({}),
+        makeViewNode({}),
+        isScrollViewRow ? makeScrollViewNode() : makeViewNode({}),
+    }));
+  }
+  auto contentShadowNode = makeViewNode(std::move(rows));
+
+  auto delegate = StateReconciliationShadowTreeDelegate{};
+  auto shadowTree = ShadowTree{
+      SurfaceId(1),
+      LayoutConstraints{},
+      LayoutContext{},
+      delegate,
+      *contextContainer};
+
+  // React commits its own version of the tree every time.
+  auto transaction = [&](RootShadowNode const &oldRootShadowNode) {
+    return std::make_shared<RootShadowNode>(
+        oldRootShadowNode,
+        ShadowNodeFragment{
+            ShadowNodeFragment::propsPlaceholder(),
+            std::make_shared<ShadowNode::ListOfShared const>(
+                ShadowNode::ListOfShared{contentShadowNode})});
+  };
+
+  shadowTree.commit(transaction, {isReconciliationEnabled});
+
+  // Native side updates the states (e.g. the user scrolls).
+  for (size_t i = 0; i < numberOfStaleStates; i++) {
+    auto const &family = *scrollViewFamilies.at(i);
+    family.setMostRecentState(scrollViewComponentDescriptor.createState(
+        family, std::make_shared<ScrollViewState const>()));
+  }
+
+  for (auto _ : state) {
+    auto status = shadowTree.commit(transaction, {isReconciliationEnabled});
+    benchmark::DoNotOptimize(status);
+  }
+}
+BENCHMARK(staleStateReconciliation)
+    ->ArgNames({"reconcile", "stale"})
+    ->Args({0, 3})
+    ->Args({1, 0})
+    ->Args({1, 3})
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace react
+} // namespace facebook
@@ -7,6 +7,7 @@
 
 #include "RuntimeScheduler.h"
 
+#include <algorithm>
 #include <utility>
 #include "ErrorUtils.h"
 
@@ -18,40 +19,82 @@ namespace react {
 RuntimeScheduler::RuntimeScheduler(
     RuntimeExecutor runtimeExecutor,
     std::function<RuntimeSchedulerTimePoint()> now)
-    : runtimeExecutor_(std::move(runtimeExecutor)), now_(std::move(now)) {}
+    : runtimeExecutor_(std::move(runtimeExecutor)),
+      now_(std::move(now)),
+      timeSliceStatisticsResetTime_(now_()),
+      delayedTasks_(now_()),
+      wakeUpTarget_(std::make_shared<WakeUpTarget>()) {
+  wakeUpTarget_->runtimeScheduler = this;
+}
+
+RuntimeScheduler::~RuntimeScheduler() {
+  {
+    std::lock_guard<std::mutex> lock(wakeUpTarget_->mutex);
+    wakeUpTarget_->runtimeScheduler = nullptr;
+  }
+  timerThread_.reset();
+
+  deleteWorkItems(submittedWorkItems_.exchange(nullptr));
+  deleteWorkItems(pendingWorkItems_);
+}
 
 void RuntimeScheduler::scheduleWork(
     std::function<void(jsi::Runtime &)> callback) const {
-  if (enableYielding_) {
+  auto workItem = new WorkItem{std::move(callback), enableYielding_, nullptr};
+  if (workItem->isAccessRequest) {
     runtimeAccessRequests_ += 1;
-    runtimeExecutor_(
-        [this, callback = std::move(callback)](jsi::Runtime &runtime) {
-          runtimeAccessRequests_ -= 1;
-          callback(runtime);
-          startWorkLoop(runtime);
-        });
-  } else {
-    runtimeExecutor_([callback = std::move(callback)](jsi::Runtime &runtime) {
-      callback(runtime);
-    });
+  }
+
+  workItem->next = submittedWorkItems_.load(std::memory_order_relaxed);
+  while (!submittedWorkItems_.compare_exchange_weak(
+      workItem->next,
+      workItem,
+      std::memory_order_release,
+      std::memory_order_relaxed)) {
+  }
+
+  // Only the first item of a batch needs to request a hop, the rest joins it.
+  if (workItem->next == nullptr) {
+    schedulePerformWorkBatch();
   }
 }
 
 std::shared_ptr<Task> RuntimeScheduler::scheduleTask(
     SchedulerPriority priority,
-    jsi::Function callback) {
-  auto expirationTime = now() + timeoutForSchedulerPriority(priority);
-  auto task =
-      std::make_shared<Task>(priority, std::move(callback), expirationTime);
-  taskQueue_.push(task);
+    jsi::Function callback,
+    RuntimeSchedulerDuration delay) {
+  auto isDelayed = delay > RuntimeSchedulerDuration::zero();
+  auto startTime = isDelayed ? now() + delay : now();
+  auto expirationTime = startTime + timeoutForSchedulerPriority(priority);
+  auto task = Task::create(priority, std::move(callback), expirationTime);
+  task->sequenceNumber = nextTaskSequenceNumber_++;
 
-  scheduleWorkLoopIfNecessary();
+  if (isDelayed) {
+    if (!timer_) {
+      timerThread_ = std::make_unique<TimerThread>();
+      timer_ = [timerThread = timerThread_.get()](
+                   RuntimeSchedulerDuration delay,
+                   std::function<void()> callback) {
+        timerThread->schedule(delay, std::move(callback));
+      };
+    }
+    delayedTasks_.insert(task, startTime);
+    scheduleWakeUpIfNecessary();
+  } else {
+    enqueueTask(task);
+    scheduleWorkLoopIfNecessary();
+  }
 
   return task;
 }
 
 bool RuntimeScheduler::getShouldYield() const noexcept {
-  return runtimeAccessRequests_ > 0;
+  if (runtimeAccessRequests_ > 0) {
+    return true;
+  }
+
+  return enableTimeSlicing_ && isPerformingWork_ &&
+      now_() >= timeSliceDeadline_.load();
 }
 
 bool RuntimeScheduler::getIsSynchronous() const noexcept {
@@ -60,6 +103,20 @@ bool RuntimeScheduler::getIsSynchronous() const noexcept {
 
 void RuntimeScheduler::cancelTask(Task &task) noexcept {
   task.callback.reset();
+
+  if (taskQueue_.remove(task) || delayedTasks_.remove(task)) {
+    return;
+  }
+
+  auto it = std::find_if(
+      idleTaskQueue_.begin(),
+      idleTaskQueue_.end(),
+      [&](std::shared_ptr<Task> const &idleTask) {
+        return idleTask.get() == &task;
+      });
+  if (it != idleTaskQueue_.end()) {
+    idleTaskQueue_.erase(it);
+  }
 }
 
 SchedulerPriority RuntimeScheduler::getCurrentPriorityLevel() const noexcept {
@@ -74,6 +131,40 @@ void RuntimeScheduler::setEnableYielding(bool enableYielding) {
   enableYielding_ = enableYielding;
 }
 
+void RuntimeScheduler::setEnableTimeSlicing(bool enableTimeSlicing) {
+  enableTimeSlicing_ = enableTimeSlicing;
+}
+
+void RuntimeScheduler::setTimeSliceDuration(
+    RuntimeSchedulerDuration timeSliceDuration) {
+  timeSliceDuration_ = timeSliceDuration;
+}
+
+RuntimeScheduler::TimeSliceStatistics
+RuntimeScheduler::getTimeSliceStatistics() const {
+  auto statistics = timeSliceStatistics_;
+  statistics.elapsedDuration = now_() - timeSliceStatisticsResetTime_;
+  return statistics;
+}
+
+void RuntimeScheduler::resetTimeSliceStatistics() {
+  timeSliceStatistics_ = {};
+  timeSliceStatisticsResetTime_ = now_();
+}
+
+void RuntimeScheduler::setTimer(Timer timer) {
+  timer_ = std::move(timer);
+}
+
+RuntimeScheduler::WorkBatchStatistics
+RuntimeScheduler::getWorkBatchStatistics() const {
+  return workBatchStatistics_;
+}
+
+void RuntimeScheduler::resetWorkBatchStatistics() {
+  workBatchStatistics_ = {};
+}
+
 void RuntimeScheduler::executeNowOnTheSameThread(
     std::function<void(jsi::Runtime &runtime)> callback) {
   runtimeAccessRequests_ += 1;
@@ -111,9 +202,7 @@ void RuntimeScheduler::callExpiredTasks(jsi::Runtime &runtime) {
         topPriorityTask->callback =
             result.getObject(runtime).getFunction(runtime);
       } else {
-        if (taskQueue_.top() == topPriorityTask) {
-          taskQueue_.pop();
-        }
+        taskQueue_.remove(*topPriorityTask);
       }
     }
   } catch (jsi::JSError &error) {
@@ -135,30 +224,139 @@ void RuntimeScheduler::scheduleWorkLoopIfNecessary() const {
   }
 }
 
+void RuntimeScheduler::schedulePerformWorkBatch() const {
+  runtimeExecutor_(
+      [this](jsi::Runtime &runtime) { performWorkBatch(runtime); });
+}
+
+void RuntimeScheduler::performWorkBatch(jsi::Runtime &runtime) const {
+  // Items are taken in reverse order of submission.
+  auto submittedWorkItems =
+      submittedWorkItems_.exchange(nullptr, std::memory_order_acquire);
+  WorkItem *workItems = nullptr;
+  auto batchSize = size_t{0};
+  while (submittedWorkItems != nullptr) {
+    auto next = submittedWorkItems->next;
+    submittedWorkItems->next = workItems;
+    workItems = submittedWorkItems;
+    submittedWorkItems = next;
+    batchSize += 1;
+  }
+
+  // Items left over by a callback which threw go first.
+  if (pendingWorkItems_ == nullptr) {
+    pendingWorkItems_ = workItems;
+  } else {
+    auto last = pendingWorkItems_;
+    while (last->next != nullptr) {
+      last = last->next;
+    }
+    last->next = workItems;
+  }
+
+  if (batchSize > 0) {
+    workBatchStatistics_.numberOfBatches += 1;
+    workBatchStatistics_.numberOfCallbacks += batchSize;
+    workBatchStatistics_.largestBatchSize =
+        std::max(workBatchStatistics_.largestBatchSize, batchSize);
+  }
+
+  auto didPerformAccessRequest = false;
+  while (pendingWorkItems_ != nullptr) {
+    auto workItem = std::unique_ptr<WorkItem>(pendingWorkItems_);
+    pendingWorkItems_ = workItem->next;
+    if (workItem->isAccessRequest) {
+      runtimeAccessRequests_ -= 1;
+      didPerformAccessRequest = true;
+    }
+
+    try {
+      workItem->callback(runtime);
+    } catch (...) {
+      if (pendingWorkItems_ != nullptr) {
+        schedulePerformWorkBatch();
+      }
+      throw;
+    }
+  }
+
+  if (didPerformAccessRequest) {
+    startWorkLoop(runtime);
+  }
+}
+
+void RuntimeScheduler::deleteWorkItems(WorkItem *workItems) {
+  while (workItems != nullptr) {
+    auto next = workItems->next;
+    delete workItems;
+    workItems = next;
+  }
+}
+
 void RuntimeScheduler::startWorkLoop(jsi::Runtime &runtime) const {
   auto previousPriority = currentPriority_;
+  auto sliceStart = now_();
+  auto didExecuteTask = false;
+  auto didYield = false;
+  timeSliceDeadline_ = sliceStart + timeSliceDuration_;
   isPerformingWork_ = true;
   try {
-    while (!taskQueue_.empty()) {
-      auto topPriorityTask = taskQueue_.top();
-      auto now = now_();
-      auto didUserCallbackTimeout = topPriorityTask->expirationTime <= now;
+    while (true) {
+      enqueueDueDelayedTasks();
+
+      if (!taskQueue_.empty()) {
+        auto topPriorityTask = taskQueue_.top();
+        auto now = now_();
+        auto didUserCallbackTimeout = topPriorityTask->expirationTime <= now;
+
+        // Every run executes at least one task to guarantee progress even if
+        // the time slice is shorter than a task.
+        auto shouldYield =
+            didExecuteTask ? getShouldYield() : runtimeAccessRequests_ > 0;
+
+        if (!didUserCallbackTimeout && shouldYield) {
+          // This currentTask hasn't expired, and we need to yield.
+          didYield = true;
+          break;
+        }
+
+        currentPriority_ = topPriorityTask->priority;
+        didExecuteTask = true;
+        auto result = topPriorityTask->execute(runtime);
 
-      if (!didUserCallbackTimeout && getShouldYield()) {
-        // This currentTask hasn't expired, and we need to yield.
+        if (result.isObject() &&
+            result.getObject(runtime).isFunction(runtime)) {
+          topPriorityTask->callback =
+              result.getObject(runtime).getFunction(runtime);
+        } else {
+          taskQueue_.remove(*topPriorityTask);
+        }
+        continue;
+      }
+
+      if (idleTaskQueue_.empty()) {
         break;
       }
 
-      currentPriority_ = topPriorityTask->priority;
-      auto result = topPriorityTask->execute(runtime);
+      // With time slicing, idle tasks only run while the time slice has time
+      // left.
+      auto isTimeSliceOver = enableTimeSlicing_ && didExecuteTask &&
+          now_() >= timeSliceDeadline_.load();
+      if (runtimeAccessRequests_ > 0 || isTimeSliceOver) {
+        didYield = true;
+        break;
+      }
+
+      auto idleTask = idleTaskQueue_.front();
+      currentPriority_ = idleTask->priority;
+      didExecuteTask = true;
+      auto result = idleTask->execute(runtime);
 
       if (result.isObject() && result.getObject(runtime).isFunction(runtime)) {
-        topPriorityTask->callback =
-            result.getObject(runtime).getFunction(runtime);
-      } else {
-        if (taskQueue_.top() == topPriorityTask) {
-          taskQueue_.pop();
-        }
+        idleTask->callback = result.getObject(runtime).getFunction(runtime);
+      } else if (
+          !idleTaskQueue_.empty() && idleTaskQueue_.front() == idleTask) {
+        idleTaskQueue_.pop_front();
       }
     }
   } catch (jsi::JSError &error) {
@@ -167,6 +365,80 @@ void RuntimeScheduler::startWorkLoop(jsi::Runtime &runtime) const {
 
   currentPriority_ = previousPriority;
   isPerformingWork_ = false;
+
+  scheduleWakeUpIfNecessary();
+
+  if (didExecuteTask) {
+    recordTimeSlice(sliceStart, didYield);
+  }
+
+  // Pending access to the runtime resumes the work loop once it is granted;
+  // otherwise the loop yielded because the time slice is over and has to be
+  // resumed explicitly.
+  if (didYield && runtimeAccessRequests_ == 0) {
+    scheduleWorkLoopIfNecessary();
+  }
+}
+
+void RuntimeScheduler::enqueueTask(std::shared_ptr<Task> task) const {
+  if (task->priority == SchedulerPriority::IdlePriority) {
+    idleTaskQueue_.push_back(std::move(task));
+  } else {
+    taskQueue_.push(std::move(task));
+  }
+}
+
+void RuntimeScheduler::enqueueDueDelayedTasks() const {
+  if (delayedTasks_.empty()) {
+    return;
+  }
+
+  delayedTasks_.advance(now_(), dueDelayedTasks_);
+  for (auto &task : dueDelayedTasks_) {
+    // Cancelled tasks are dropped.
+    if (task->callback) {
+      enqueueTask(std::move(task));
+    }
+  }
+  dueDelayedTasks_.clear();
+}
+
+void RuntimeScheduler::scheduleWakeUpIfNecessary() const {
+  if (!timer_) {
+    return;
+  }
+
+  auto now = now_();
+  if (wakeUpTime_ && *wakeUpTime_ <= now) {
+    // The wake-up is due, the timer has fired or is about to fire.
+    wakeUpTime_.reset();
+  }
+
+  auto nextDueTime = delayedTasks_.getNextDueTime();
+  if (!nextDueTime || (wakeUpTime_ && *wakeUpTime_ <= *nextDueTime)) {
+    return;
+  }
+
+  wakeUpTime_ = nextDueTime;
+  timer_(
+      std::max(*nextDueTime - now, RuntimeSchedulerDuration::zero()),
+      [wakeUpTarget = wakeUpTarget_]() {
+        std::lock_guard<std::mutex> lock(wakeUpTarget->mutex);
+        if (wakeUpTarget->runtimeScheduler != nullptr) {
+          wakeUpTarget->runtimeScheduler->scheduleWorkLoopIfNecessary();
+        }
+      });
+}
+
+void RuntimeScheduler::recordTimeSlice(
+    RuntimeSchedulerTimePoint sliceStart,
+    bool didYield) const {
+  auto sliceDuration = now_() - sliceStart;
+  timeSliceStatistics_.numberOfSlices += 1;
+  timeSliceStatistics_.numberOfYields += didYield ? 1 : 0;
+  timeSliceStatistics_.totalSliceDuration += sliceDuration;
+  timeSliceStatistics_.longestSliceDuration =
+      std::max(timeSliceStatistics_.longestSliceDuration, sliceDuration);
 }
 
 } // namespace react
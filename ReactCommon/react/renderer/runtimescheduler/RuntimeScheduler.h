@@ -10,15 +10,75 @@
 #include <ReactCommon/RuntimeExecutor.h>
 #include <react/renderer/runtimescheduler/RuntimeSchedulerClock.h>
 #include <react/renderer/runtimescheduler/Task.h>
+#include <react/renderer/runtimescheduler/TaskHeap.h>
+#include <react/renderer/runtimescheduler/TimerThread.h>
+#include <react/renderer/runtimescheduler/TimingWheel.h>
 #include <atomic>
+#include <deque>
 #include <memory>
-#include <queue>
+#include <mutex>
+#include <optional>
 
 namespace facebook {
 namespace react {
 
 class RuntimeScheduler final {
  public:
+  /*
+   * Describes time slices of the work loop since the statistics were reset.
+   */
+  struct TimeSliceStatistics {
+    /*
+     * Number of work loop runs which executed at least one task.
+     */
+    size_t numberOfSlices{0};
+
+    /*
+     * Number of times the work loop yielded to the host platform with tasks
+     * still pending.
+     */
+    size_t numberOfYields{0};
+
+    RuntimeSchedulerDuration totalSliceDuration{0};
+    RuntimeSchedulerDuration longestSliceDuration{0};
+
+    /*
+     * Time elapsed since the statistics were reset.
+     */
+    RuntimeSchedulerDuration elapsedDuration{0};
+
+    double yieldsPerSecond() const {
+      auto seconds = std::chrono::duration<double>(elapsedDuration).count();
+      return seconds > 0 ? numberOfYields / seconds : 0;
+    }
+  };
+
+  /*
+   * Describes batches in which callbacks submitted via `scheduleWork` were
+   * executed since the statistics were reset.
+   */
+  struct WorkBatchStatistics {
+    size_t numberOfBatches{0};
+    size_t numberOfCallbacks{0};
+    size_t largestBatchSize{0};
+
+    double averageBatchSize() const {
+      return numberOfBatches > 0
+          ? static_cast<double>(numberOfCallbacks) / numberOfBatches
+          : 0;
+    }
+  };
+
+  static constexpr RuntimeSchedulerDuration kDefaultTimeSliceDuration =
+      std::chrono::milliseconds(5);
+
+  /*
+   * Calls `callback` (on any thread) after `delay`. Provided by the host
+   * platform to wake the work loop up when a delayed task becomes due.
+   */
+  using Timer = std::function<
+      void(RuntimeSchedulerDuration delay, std::function<void()> callback)>;
+
   RuntimeScheduler(
       RuntimeExecutor runtimeExecutor,
       std::function<RuntimeSchedulerTimePoint()> now =
@@ -35,6 +95,24 @@ class RuntimeScheduler final {
   RuntimeScheduler(RuntimeScheduler &&) = delete;
   RuntimeScheduler &operator=(RuntimeScheduler &&) = delete;
 
+  ~RuntimeScheduler();
+
+  /*
+   * Executes `callback` on the JavaScript thread.
+   *
+   * Callbacks are collected in a lock-free queue which is drained in a single
+   * call of `runtimeExecutor`; the executor is only called when the queue
+   * goes from empty to non-empty, so bursts of callbacks from other threads
+   * take a single hop to the JavaScript thread.
+   *
+   * Callbacks run in order of submission. A callback joins the pending batch
+   * if there is one, so it can run *before* other hops to the JavaScript
+   * thread which were requested after the batch but before the callback was
+   * submitted (e.g. the hop of the work loop or of a timer wake-up); it never
+   * runs after a hop requested after its submission.
+   *
+   * Can be called from any thread.
+   */
   void scheduleWork(std::function<void(jsi::Runtime &)> callback) const;
 
   /*
@@ -51,14 +129,21 @@ class RuntimeScheduler final {
    * Adds a JavaScript callback to priority queue with given priority.
    * Triggers workloop if needed.
    *
+   * A task with a positive `delay` is kept in a timing wheel and added to the
+   * queue once the delay elapses. Tasks with `IdlePriority` are kept in a
+   * separate lane which only runs when no other task is pending and (if time
+   * slicing is enabled) the current time slice has time left.
+   *
    * Thread synchronization must be enforced externally.
    */
   std::shared_ptr<Task> scheduleTask(
       SchedulerPriority priority,
-      jsi::Function callback);
+      jsi::Function callback,
+      RuntimeSchedulerDuration delay = RuntimeSchedulerDuration::zero());
 
   /*
-   * Cancelled task will never be executed.
+   * Cancelled task will never be executed. It is removed from the task queue
+   * (or from the timing wheel) right away.
    *
    * Operates on JSI object.
    * Thread synchronization must be enforced externally.
@@ -67,7 +152,8 @@ class RuntimeScheduler final {
 
   /*
    * Return value indicates if host platform has a pending access to the
-   * runtime.
+   * runtime or if the current time slice is over (if time slicing is
+   * enabled).
    *
    * Can be called from any thread.
    */
@@ -107,12 +193,48 @@ class RuntimeScheduler final {
   void callExpiredTasks(jsi::Runtime &runtime);
   void setEnableYielding(bool enableYielding);
 
+  /*
+   * Enables or disables time slicing. If enabled, the work loop yields to the
+   * host platform once it runs for longer than the time slice duration and
+   * continues with the remaining tasks in a subsequent run.
+   * Default value is false.
+   */
+  void setEnableTimeSlicing(bool enableTimeSlicing);
+  void setTimeSliceDuration(RuntimeSchedulerDuration timeSliceDuration);
+
+  /*
+   * Returns statistics of time slices since the last reset (or since
+   * construction).
+   *
+   * Thread synchronization must be enforced externally.
+   */
+  TimeSliceStatistics getTimeSliceStatistics() const;
+  void resetTimeSliceStatistics();
+
+  /*
+   * Returns statistics of batches of callbacks submitted via `scheduleWork`
+   * since the last reset.
+   *
+   * Thread synchronization must be enforced externally.
+   */
+  WorkBatchStatistics getWorkBatchStatistics() const;
+  void resetWorkBatchStatistics();
+
+  /*
+   * Sets the timer which wakes the work loop up when delayed tasks become
+   * due. Only one wake-up is requested at a time. Without a timer set by the
+   * host platform, a `TimerThread` is started once the first delayed task is
+   * scheduled. Must be set before any delayed task is scheduled.
+   */
+  void setTimer(Timer timer);
+
  private:
-  mutable std::priority_queue<
-      std::shared_ptr<Task>,
-      std::vector<std::shared_ptr<Task>>,
-      TaskPriorityComparer>
-      taskQueue_;
+  mutable TaskHeap taskQueue_;
+
+  /*
+   * Tasks with `IdlePriority` in order of scheduling.
+   */
+  mutable std::deque<std::shared_ptr<Task>> idleTaskQueue_;
 
   RuntimeExecutor const runtimeExecutor_;
   mutable SchedulerPriority currentPriority_{SchedulerPriority::NormalPriority};
@@ -120,12 +242,47 @@ class RuntimeScheduler final {
   /*
    * Counter indicating how many access to the runtime have been requested.
    */
-  mutable std::atomic<uint_fast8_t> runtimeAccessRequests_{0};
+  mutable std::atomic<uint_fast32_t> runtimeAccessRequests_{0};
 
   mutable std::atomic_bool isSynchronous_{false};
 
+  mutable uint64_t nextTaskSequenceNumber_{0};
+
   void startWorkLoop(jsi::Runtime &runtime) const;
 
+  struct WorkItem {
+    std::function<void(jsi::Runtime &)> callback;
+    /*
+     * Whether the item was counted in `runtimeAccessRequests_`.
+     */
+    bool isAccessRequest;
+    WorkItem *next;
+  };
+
+  /*
+   * Executes callbacks submitted via `scheduleWork`.
+   */
+  void performWorkBatch(jsi::Runtime &runtime) const;
+  void schedulePerformWorkBatch() const;
+  static void deleteWorkItems(WorkItem *workItems);
+
+  void recordTimeSlice(
+      RuntimeSchedulerTimePoint sliceStart,
+      bool didYield) const;
+
+  void enqueueTask(std::shared_ptr<Task> task) const;
+
+  /*
+   * Moves delayed tasks which became due to the task queues.
+   */
+  void enqueueDueDelayedTasks() const;
+
+  /*
+   * Requests a wake-up from the timer for the earliest delayed task unless
+   * an earlier wake-up is pending already.
+   */
+  void scheduleWakeUpIfNecessary() const;
+
   /*
    * Schedules a work loop unless it has been already scheduled
    * This is to avoid unnecessary calls to `runtimeExecutor`.
@@ -153,6 +310,57 @@ class RuntimeScheduler final {
    */
   bool enableYielding_{false};
 
+  bool enableTimeSlicing_{false};
+  RuntimeSchedulerDuration timeSliceDuration_{kDefaultTimeSliceDuration};
+
+  /*
+   * Point in time when the current run of the work loop should yield.
+   */
+  mutable std::atomic<RuntimeSchedulerTimePoint> timeSliceDeadline_{};
+
+  mutable TimeSliceStatistics timeSliceStatistics_{};
+  mutable RuntimeSchedulerTimePoint timeSliceStatisticsResetTime_{};
+
+  /*
+   * Stack of submitted work items, the most recent one first.
+   * Lock-free, multiple producers, single consumer.
+   */
+  mutable std::atomic<WorkItem *> submittedWorkItems_{nullptr};
+
+  /*
+   * Work items taken from `submittedWorkItems_` in order of submission which
+   * are yet to be executed. Accessed on the JavaScript thread only.
+   */
+  mutable WorkItem *pendingWorkItems_{nullptr};
+
+  mutable WorkBatchStatistics workBatchStatistics_{};
+
+  mutable TimingWheel delayedTasks_;
+  mutable std::vector<std::shared_ptr<Task>> dueDelayedTasks_;
+
+  Timer timer_;
+
+  /*
+   * Backs `timer_` if the host platform does not provide a timer.
+   */
+  std::unique_ptr<TimerThread> timerThread_;
+
+  /*
+   * Wake-ups requested from `timer_` go through this object (rather than
+   * through `this`), so wake-ups which fire after the scheduler is destroyed
+   * do nothing.
+   */
+  struct WakeUpTarget {
+    std::mutex mutex;
+    RuntimeScheduler const *runtimeScheduler; // Protected by `mutex`.
+  };
+  std::shared_ptr<WakeUpTarget> wakeUpTarget_;
+
+  /*
+   * Point in time of the pending wake-up requested from `timer_`.
+   */
+  mutable std::optional<RuntimeSchedulerTimePoint> wakeUpTime_;
+
   /*
    * This flag is set while performing work, to prevent re-entrancy.
    */
@@ -7,9 +7,98 @@
 
 #include "RuntimeScheduler.h"
 
+#include <mutex>
+#include <new>
+
 namespace facebook {
 namespace react {
 
+namespace {
+
+/*
+ * Free list of memory blocks which held tasks (along with their control
+ * blocks). Tasks are usually destroyed on the JavaScript thread but not
+ * necessarily, so the pool is thread-safe.
+ */
+class TaskMemoryPool final {
+ public:
+  void *allocate(size_t size) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (size == blockSize_ && freeBlocks_ != nullptr) {
+        auto block = freeBlocks_;
+        freeBlocks_ = block->next;
+        numberOfFreeBlocks_ -= 1;
+        return block;
+      }
+    }
+    return ::operator new(size);
+  }
+
+  void deallocate(void *pointer, size_t size) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (blockSize_ == 0 && size >= sizeof(FreeBlock)) {
+        blockSize_ = size;
+      }
+      if (size == blockSize_ && numberOfFreeBlocks_ < kMaxNumberOfFreeBlocks) {
+        freeBlocks_ = new (pointer) FreeBlock{freeBlocks_};
+        numberOfFreeBlocks_ += 1;
+        return;
+      }
+    }
+    ::operator delete(pointer);
+  }
+
+ private:
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  static constexpr size_t kMaxNumberOfFreeBlocks = 1024;
+
+  std::mutex mutex_;
+  FreeBlock *freeBlocks_{nullptr}; // Protected by `mutex_`.
+  size_t numberOfFreeBlocks_{0}; // Protected by `mutex_`.
+  size_t blockSize_{0}; // Protected by `mutex_`.
+};
+
+TaskMemoryPool &taskMemoryPool() {
+  // Intentionally leaked, tasks may outlive static destructors.
+  static auto pool = new TaskMemoryPool();
+  return *pool;
+}
+
+template <typename T>
+struct TaskAllocator {
+  using value_type = T;
+
+  TaskAllocator() = default;
+
+  template <typename U>
+  TaskAllocator(TaskAllocator<U> const &) {}
+
+  T *allocate(size_t n) {
+    return static_cast<T *>(taskMemoryPool().allocate(n * sizeof(T)));
+  }
+
+  void deallocate(T *pointer, size_t n) {
+    taskMemoryPool().deallocate(pointer, n * sizeof(T));
+  }
+
+  template <typename U>
+  bool operator==(TaskAllocator<U> const &) const {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(TaskAllocator<U> const &) const {
+    return false;
+  }
+};
+
+} // namespace
+
 Task::Task(
     SchedulerPriority priority,
     jsi::Function callback,
@@ -18,6 +107,14 @@ Task::Task(
       callback(std::move(callback)),
       expirationTime(expirationTime) {}
 
+std::shared_ptr<Task> Task::create(
+    SchedulerPriority priority,
+    jsi::Function callback,
+    std::chrono::steady_clock::time_point expirationTime) {
+  return std::allocate_shared<Task>(
+      TaskAllocator<Task>{}, priority, std::move(callback), expirationTime);
+}
+
 jsi::Value Task::execute(jsi::Runtime &runtime) {
   auto result = jsi::Value::undefined();
   // Cancelled task doesn't have a callback.
@@ -11,13 +11,18 @@
 #include <react/renderer/runtimescheduler/RuntimeSchedulerClock.h>
 #include <react/renderer/runtimescheduler/SchedulerPriority.h>
 
+#include <cstdint>
+#include <limits>
+#include <memory>
 #include <optional>
 
 namespace facebook {
 namespace react {
 
 class RuntimeScheduler;
+class TaskHeap;
 class TaskPriorityComparer;
+class TimingWheel;
 
 struct Task final {
   Task(
@@ -25,14 +30,45 @@ struct Task final {
       jsi::Function callback,
       std::chrono::steady_clock::time_point expirationTime);
 
+  /*
+   * Creates a task. Memory of destroyed tasks is reused, React schedules and
+   * cancels tasks at a high rate.
+   */
+  static std::shared_ptr<Task> create(
+      SchedulerPriority priority,
+      jsi::Function callback,
+      std::chrono::steady_clock::time_point expirationTime);
+
  private:
   friend RuntimeScheduler;
+  friend TaskHeap;
   friend TaskPriorityComparer;
+  friend TimingWheel;
+
+  static constexpr size_t kNotInHeap = std::numeric_limits<size_t>::max();
+  static constexpr uint64_t kNotInTimingWheel =
+      std::numeric_limits<uint64_t>::max();
 
   SchedulerPriority priority;
   std::optional<jsi::Function> callback;
   RuntimeSchedulerClock::time_point expirationTime;
 
+  /*
+   * Order of scheduling; breaks ties between tasks with the same expiration
+   * time.
+   */
+  uint64_t sequenceNumber{0};
+
+  /*
+   * Position of the task in `TaskHeap`.
+   */
+  size_t heapIndex{kNotInHeap};
+
+  /*
+   * Tick of `TimingWheel` at which the task becomes due (if it is delayed).
+   */
+  uint64_t timingWheelTick{kNotInTimingWheel};
+
   jsi::Value execute(jsi::Runtime &runtime);
 };
 
@@ -41,7 +77,10 @@ class TaskPriorityComparer {
   inline bool operator()(
       std::shared_ptr<Task> const &lhs,
       std::shared_ptr<Task> const &rhs) {
-    return lhs->expirationTime > rhs->expirationTime;
+    if (lhs->expirationTime != rhs->expirationTime) {
+      return lhs->expirationTime > rhs->expirationTime;
+    }
+    return lhs->sequenceNumber > rhs->sequenceNumber;
   }
 };
 
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TaskHeap.h"
+
+#include <react/debug/react_native_assert.h>
+#include <utility>
+
+namespace facebook {
+namespace react {
+
+bool TaskHeap::empty() const {
+  return tasks_.empty();
+}
+
+size_t TaskHeap::size() const {
+  return tasks_.size();
+}
+
+std::shared_ptr<Task> const &TaskHeap::top() const {
+  react_native_assert(!tasks_.empty());
+  return tasks_.front();
+}
+
+void TaskHeap::push(std::shared_ptr<Task> task) {
+  react_native_assert(task->heapIndex == Task::kNotInHeap);
+  task->heapIndex = tasks_.size();
+  tasks_.push_back(std::move(task));
+  siftUp(tasks_.size() - 1);
+}
+
+void TaskHeap::pop() {
+  react_native_assert(!tasks_.empty());
+  removeAt(0);
+}
+
+bool TaskHeap::remove(Task const &task) {
+  if (!contains(task)) {
+    return false;
+  }
+  removeAt(task.heapIndex);
+  return true;
+}
+
+bool TaskHeap::contains(Task const &task) const {
+  return task.heapIndex < tasks_.size() &&
+      tasks_[task.heapIndex].get() == &task;
+}
+
+#pragma mark - Private
+
+bool TaskHeap::isBefore(size_t lhs, size_t rhs) const {
+  return TaskPriorityComparer{}(tasks_[rhs], tasks_[lhs]);
+}
+
+void TaskHeap::swap(size_t lhs, size_t rhs) {
+  std::swap(tasks_[lhs], tasks_[rhs]);
+  tasks_[lhs]->heapIndex = lhs;
+  tasks_[rhs]->heapIndex = rhs;
+}
+
+void TaskHeap::siftUp(size_t index) {
+  while (index > 0) {
+    auto parent = (index - 1) / 2;
+    if (!isBefore(index, parent)) {
+      break;
+    }
+    swap(index, parent);
+    index = parent;
+  }
+}
+
+void TaskHeap::siftDown(size_t index) {
+  while (true) {
+    auto first = index;
+    auto left = 2 * index + 1;
+    auto right = left + 1;
+    if (left < tasks_.size() && isBefore(left, first)) {
+      first = left;
+    }
+    if (right < tasks_.size() && isBefore(right, first)) {
+      first = right;
+    }
+    if (first == index) {
+      break;
+    }
+    swap(index, first);
+    index = first;
+  }
+}
+
+void TaskHeap::removeAt(size_t index) {
+  auto last = tasks_.size() - 1;
+  if (index != last) {
+    swap(index, last);
+  }
+  tasks_.back()->heapIndex = Task::kNotInHeap;
+  tasks_.pop_back();
+  if (index < tasks_.size()) {
+    // The moved task may belong either above or below its new position.
+    siftUp(index);
+    siftDown(index);
+  }
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/runtimescheduler/Task.h>
+
+#include <memory>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Binary min-heap of tasks ordered by expiration time (and order of
+ * scheduling). Tasks know their position in the heap, so they can be removed
+ * in O(log n) when cancelled instead of lingering until they reach the top.
+ * A task can be in at most one heap at a time.
+ *
+ * Thread synchronization must be enforced externally.
+ */
+class TaskHeap final {
+ public:
+  bool empty() const;
+  size_t size() const;
+
+  /*
+   * Returns the task which expires first. The heap must not be empty.
+   */
+  std::shared_ptr<Task> const &top() const;
+
+  void push(std::shared_ptr<Task> task);
+  void pop();
+
+  /*
+   * Removes the task if it is in the heap. Returns whether it was.
+   */
+  bool remove(Task const &task);
+
+  bool contains(Task const &task) const;
+
+ private:
+  bool isBefore(size_t lhs, size_t rhs) const;
+  void swap(size_t lhs, size_t rhs);
+  void siftUp(size_t index);
+  void siftDown(size_t index);
+  void removeAt(size_t index);
+
+  std::vector<std::shared_ptr<Task>> tasks_;
+};
+
+} // namespace react
+} // namespace facebook
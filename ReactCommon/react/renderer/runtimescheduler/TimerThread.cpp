@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TimerThread.h"
+
+#include <utility>
+
+namespace facebook {
+namespace react {
+
+TimerThread::TimerThread() : thread_([this]() { run(); }) {}
+
+TimerThread::~TimerThread() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isStopping_ = true;
+  }
+  signal_.notify_one();
+  thread_.join();
+}
+
+void TimerThread::schedule(
+    RuntimeSchedulerDuration delay,
+    std::function<void()> callback) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    callbacks_.emplace(
+        RuntimeSchedulerClock::now() + delay, std::move(callback));
+  }
+  signal_.notify_one();
+}
+
+void TimerThread::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!isStopping_) {
+    if (callbacks_.empty()) {
+      signal_.wait(lock);
+      continue;
+    }
+
+    auto first = callbacks_.begin();
+    if (RuntimeSchedulerClock::now() < first->first) {
+      signal_.wait_until(lock, first->first);
+      continue;
+    }
+
+    auto callback = std::move(first->second);
+    callbacks_.erase(first);
+
+    lock.unlock();
+    callback();
+    lock.lock();
+  }
+}
+
+} // namespace react
+} // namespace facebook
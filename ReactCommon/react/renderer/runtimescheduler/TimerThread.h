@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/runtimescheduler/RuntimeSchedulerClock.h>
+
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Calls callbacks on a dedicated thread once their delays elapse.
+ * `RuntimeScheduler` uses it to wake the work loop up when the host platform
+ * does not provide a timer. Callbacks which are still pending when the object
+ * is destroyed are never called.
+ *
+ * Thread-safe.
+ */
+class TimerThread final {
+ public:
+  TimerThread();
+
+  /*
+   * Not copyable, not movable.
+   */
+  TimerThread(TimerThread const &) = delete;
+  TimerThread &operator=(TimerThread const &) = delete;
+
+  /*
+   * Waits for a running callback to finish.
+   */
+  ~TimerThread();
+
+  void schedule(RuntimeSchedulerDuration delay, std::function<void()> callback);
+
+ private:
+  void run();
+
+  std::mutex mutex_;
+  std::condition_variable signal_;
+  std::multimap<RuntimeSchedulerTimePoint, std::function<void()>>
+      callbacks_; // Protected by `mutex_`.
+  bool isStopping_{false}; // Protected by `mutex_`.
+
+  // Must be initialized last, the thread accesses the members above.
+  std::thread thread_;
+};
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TimingWheel.h"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace facebook {
+namespace react {
+
+TimingWheel::TimingWheel(RuntimeSchedulerTimePoint origin) : origin_(origin) {}
+
+void TimingWheel::insert(
+    std::shared_ptr<Task> task,
+    RuntimeSchedulerTimePoint dueTime) {
+  // Rounds up, a task must not become due before its due time.
+  auto dueTick = dueTime <= origin_
+      ? uint64_t{0}
+      : static_cast<uint64_t>(
+            std::chrono::ceil<std::chrono::milliseconds>(dueTime - origin_)
+                .count());
+  size_ += 1;
+  task->timingWheelTick = dueTick;
+  insertEntry(Entry{dueTick, std::move(task)});
+}
+
+bool TimingWheel::remove(Task const &task) {
+  if (task.timingWheelTick == Task::kNotInTimingWheel) {
+    return false;
+  }
+
+  auto &entries = entriesForDueTick(task.timingWheelTick);
+  auto it = std::find_if(entries.begin(), entries.end(), [&](auto &entry) {
+    return entry.task.get() == &task;
+  });
+  if (it == entries.end()) {
+    return false;
+  }
+
+  it->task->timingWheelTick = Task::kNotInTimingWheel;
+  entries.erase(it);
+  size_ -= 1;
+  return true;
+}
+
+void TimingWheel::advance(
+    RuntimeSchedulerTimePoint now,
+    std::vector<std::shared_ptr<Task>> &dueTasks) {
+  auto drainDueEntries = [&]() {
+    for (auto &entry : dueEntries_) {
+      entry.task->timingWheelTick = Task::kNotInTimingWheel;
+      dueTasks.push_back(std::move(entry.task));
+    }
+    size_ -= dueEntries_.size();
+    dueEntries_.clear();
+  };
+
+  drainDueEntries();
+
+  auto targetTick = tickFromTimePoint(now);
+  while (currentTick_ < targetTick) {
+    auto nextDueTime = getNextDueTime();
+    if (!nextDueTime) {
+      currentTick_ = targetTick;
+      break;
+    }
+
+    // Nothing happens before the next due tick, skip right to it.
+    auto nextDueTick = tickFromTimePoint(*nextDueTime);
+    if (nextDueTick > targetTick) {
+      currentTick_ = targetTick;
+      break;
+    }
+    if (nextDueTick > currentTick_ + 1) {
+      currentTick_ = nextDueTick - 1;
+    }
+
+    currentTick_ += 1;
+
+    // Coarser levels go first, they may refill finer levels.
+    for (auto level = kNumberOfLevels - 1; level > 0; level--) {
+      auto mask = (uint64_t{1} << (kBitsPerLevel * level)) - 1;
+      if ((currentTick_ & mask) == 0) {
+        cascade(level);
+      }
+    }
+
+    auto &slot = levels_[0][slotIndex(currentTick_, 0)];
+    for (auto &entry : slot) {
+      dueEntries_.push_back(std::move(entry));
+    }
+    slot.clear();
+
+    drainDueEntries();
+  }
+}
+
+std::optional<RuntimeSchedulerTimePoint> TimingWheel::getNextDueTime() const {
+  if (!dueEntries_.empty()) {
+    return timePointFromTick(currentTick_);
+  }
+
+  if (size_ == 0) {
+    return std::nullopt;
+  }
+
+  // Tasks on finer levels are always due earlier than tasks on coarser ones.
+  for (auto level = 0; level < kNumberOfLevels; level++) {
+    auto const &slots = levels_[level];
+    auto shift = kBitsPerLevel * level;
+    auto levelStartTick =
+        (currentTick_ >> (shift + kBitsPerLevel)) << (shift + kBitsPerLevel);
+    for (auto index = slotIndex(currentTick_, level) + 1;
+         index < kSlotsPerLevel;
+         index++) {
+      if (!slots[index].empty()) {
+        return timePointFromTick(
+            levelStartTick | (static_cast<uint64_t>(index) << shift));
+      }
+    }
+  }
+
+  // Only tasks beyond the span of the wheel are left; they are reinserted
+  // once the wheel wraps around.
+  auto wheelBits = kBitsPerLevel * kNumberOfLevels;
+  return timePointFromTick(((currentTick_ >> wheelBits) + 1) << wheelBits);
+}
+
+size_t TimingWheel::size() const {
+  return size_;
+}
+
+bool TimingWheel::empty() const {
+  return size_ == 0;
+}
+
+#pragma mark - Private
+
+size_t TimingWheel::slotIndex(uint64_t tick, int level) {
+  return (tick >> (kBitsPerLevel * level)) & (kSlotsPerLevel - 1);
+}
+
+uint64_t TimingWheel::tickFromTimePoint(
+    RuntimeSchedulerTimePoint timePoint) const {
+  if (timePoint <= origin_) {
+    return 0;
+  }
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          timePoint - origin_)
+          .count());
+}
+
+RuntimeSchedulerTimePoint TimingWheel::timePointFromTick(
+    uint64_t tick) const {
+  return origin_ + std::chrono::milliseconds(tick);
+}
+
+std::vector<TimingWheel::Entry> &TimingWheel::entriesForDueTick(
+    uint64_t dueTick) {
+  if (dueTick <= currentTick_) {
+    return dueEntries_;
+  }
+
+  // The entry goes to the finest level on which it shares the slot of the
+  // enclosing (coarser) level with the current tick; the slot is reached
+  // before the entry is due. Until then, this stays the slot of the entry.
+  for (auto level = 0; level < kNumberOfLevels; level++) {
+    auto shift = kBitsPerLevel * (level + 1);
+    if ((dueTick >> shift) == (currentTick_ >> shift)) {
+      return levels_[level][slotIndex(dueTick, level)];
+    }
+  }
+
+  // Beyond the span of the wheel. The first slot of the coarsest level is
+  // never used otherwise and is cascaded when the wheel wraps around.
+  return levels_[kNumberOfLevels - 1][0];
+}
+
+void TimingWheel::insertEntry(Entry &&entry) {
+  entriesForDueTick(entry.dueTick).push_back(std::move(entry));
+}
+
+void TimingWheel::cascade(int level) {
+  auto entries = std::move(levels_[level][slotIndex(currentTick_, level)]);
+  levels_[level][slotIndex(currentTick_, level)].clear();
+  for (auto &entry : entries) {
+    insertEntry(std::move(entry));
+  }
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/runtimescheduler/RuntimeSchedulerClock.h>
+#include <react/renderer/runtimescheduler/Task.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Hierarchical timing wheel which holds delayed tasks until they are due.
+ * Insertion is O(1); advancing the wheel is O(1) per elapsed millisecond plus
+ * O(1) per task which is moved to a finer level or becomes due.
+ *
+ * The resolution is one millisecond; a task never becomes due before its due
+ * time and at most a millisecond after it (given the wheel is advanced).
+ * The wheel has four levels of 64 slots each and spans ~4.6 hours; tasks due
+ * later than that are kept in the last slot and reinserted when it is
+ * reached.
+ *
+ * Thread synchronization must be enforced externally.
+ */
+class TimingWheel final {
+ public:
+  /*
+   * `origin` is the point in time which corresponds to the first tick of the
+   * wheel; it must not be later than any time point passed to `advance`.
+   */
+  explicit TimingWheel(RuntimeSchedulerTimePoint origin);
+
+  /*
+   * Adds a task which becomes due at `dueTime`.
+   */
+  void insert(std::shared_ptr<Task> task, RuntimeSchedulerTimePoint dueTime);
+
+  /*
+   * Removes the task from the wheel. Returns `false` if the task is not in
+   * the wheel. O(1) plus the number of tasks in the slot of the task.
+   */
+  bool remove(Task const &task);
+
+  /*
+   * Moves the wheel forward to `now` and appends tasks which became due to
+   * `dueTasks` in order of their due time.
+   */
+  void advance(
+      RuntimeSchedulerTimePoint now,
+      std::vector<std::shared_ptr<Task>> &dueTasks);
+
+  /*
+   * Returns a point in time which is not later than the due time of the
+   * earliest task in the wheel; advancing the wheel to it yields the task or
+   * narrows down the next due time. Returns an empty optional if the wheel is
+   * empty.
+   */
+  std::optional<RuntimeSchedulerTimePoint> getNextDueTime() const;
+
+  size_t size() const;
+  bool empty() const;
+
+ private:
+  struct Entry {
+    uint64_t dueTick;
+    std::shared_ptr<Task> task;
+  };
+
+  static constexpr int kBitsPerLevel = 6;
+  static constexpr size_t kSlotsPerLevel = 1 << kBitsPerLevel;
+  static constexpr int kNumberOfLevels = 4;
+
+  using Slot = std::vector<Entry>;
+  using Level = std::array<Slot, kSlotsPerLevel>;
+
+  static size_t slotIndex(uint64_t tick, int level);
+
+  uint64_t tickFromTimePoint(RuntimeSchedulerTimePoint timePoint) const;
+  RuntimeSchedulerTimePoint timePointFromTick(uint64_t tick) const;
+
+  /*
+   * Returns entries which hold tasks due at `dueTick`: the slot which is
+   * reached before `dueTick` (or the due entries if `dueTick` has passed).
+   */
+  std::vector<Entry> &entriesForDueTick(uint64_t dueTick);
+
+  void insertEntry(Entry &&entry);
+  void cascade(int level);
+
+  RuntimeSchedulerTimePoint const origin_;
+  uint64_t currentTick_{0};
+  size_t size_{0};
+  std::array<Level, kNumberOfLevels> levels_{};
+
+  /*
+   * Entries which are due but not yet returned by `advance`.
+   */
+  std::vector<Entry> dueEntries_{};
+};
+
+} // namespace react
+} // namespace facebook
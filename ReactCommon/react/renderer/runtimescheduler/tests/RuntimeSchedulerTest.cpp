@@ -10,6 +10,7 @@
 #include <jsi/jsi.h>
 #include <react/renderer/runtimescheduler/RuntimeScheduler.h>
 #include <memory>
+#include <vector>
 
 #include "StubClock.h"
 #include "StubErrorUtils.h"
@@ -246,6 +247,45 @@ TEST_F(RuntimeSchedulerTest, cancelTask) {
   EXPECT_EQ(stubQueue_->size(), 0);
 }
 
+TEST_F(RuntimeSchedulerTest, cancelledTaskIsRemovedFromQueue) {
+  uint callOrder = 0;
+  uint firstTaskCallOrder = 0;
+  uint thirdTaskCallOrder = 0;
+
+  auto firstTask = runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority,
+      createHostFunctionFromLambda([&](bool) {
+        firstTaskCallOrder = ++callOrder;
+        return jsi::Value::undefined();
+      }));
+  auto secondTask = runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority,
+      createHostFunctionFromLambda([&](bool) {
+        ++callOrder;
+        return jsi::Value::undefined();
+      }));
+  auto thirdTask = runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority,
+      createHostFunctionFromLambda([&](bool) {
+        thirdTaskCallOrder = ++callOrder;
+        return jsi::Value::undefined();
+      }));
+
+  std::weak_ptr<Task> weakSecondTask = secondTask;
+  runtimeScheduler_->cancelTask(*secondTask);
+  secondTask.reset();
+
+  // The scheduler doesn't retain the cancelled task.
+  EXPECT_TRUE(weakSecondTask.expired());
+
+  stubQueue_->tick();
+
+  EXPECT_EQ(firstTaskCallOrder, 1);
+  EXPECT_EQ(thirdTaskCallOrder, 2);
+  EXPECT_EQ(hostFunctionCallCount_, 2);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
 TEST_F(RuntimeSchedulerTest, continuationTask) {
   bool didRunTask = false;
   bool didContinuationTask = false;
@@ -353,6 +393,82 @@ TEST_F(RuntimeSchedulerTest, scheduleWorkWithYielding) {
   EXPECT_EQ(stubQueue_->size(), 0);
 }
 
+TEST_F(RuntimeSchedulerTest, scheduleWorkCoalescesCallbacks) {
+  std::vector<int> calls;
+  for (int i = 0; i < 3; i++) {
+    runtimeScheduler_->scheduleWork(
+        [&calls, i](jsi::Runtime const &) { calls.push_back(i); });
+  }
+
+  // A single hop to the JavaScript thread executes all callbacks.
+  EXPECT_EQ(stubQueue_->size(), 1);
+  EXPECT_TRUE(runtimeScheduler_->getShouldYield());
+
+  stubQueue_->tick();
+
+  EXPECT_EQ(calls, (std::vector<int>{0, 1, 2}));
+  EXPECT_FALSE(runtimeScheduler_->getShouldYield());
+  EXPECT_EQ(stubQueue_->size(), 0);
+
+  runtimeScheduler_->scheduleWork(
+      [&calls](jsi::Runtime const &) { calls.push_back(3); });
+
+  EXPECT_EQ(stubQueue_->size(), 1);
+
+  stubQueue_->tick();
+
+  EXPECT_EQ(calls, (std::vector<int>{0, 1, 2, 3}));
+
+  auto statistics = runtimeScheduler_->getWorkBatchStatistics();
+  EXPECT_EQ(statistics.numberOfBatches, 2);
+  EXPECT_EQ(statistics.numberOfCallbacks, 4);
+  EXPECT_EQ(statistics.largestBatchSize, 3);
+  EXPECT_DOUBLE_EQ(statistics.averageBatchSize(), 2);
+}
+
+TEST_F(RuntimeSchedulerTest, scheduleWorkOrderingRelativeToWorkLoop) {
+  runtimeScheduler_->setEnableYielding(false);
+  std::vector<std::string> calls;
+
+  auto scheduleTask = [&](std::string name) {
+    runtimeScheduler_->scheduleTask(
+        SchedulerPriority::ImmediatePriority,
+        createHostFunctionFromLambda([&calls, name](bool) {
+          calls.push_back(name);
+          return jsi::Value::undefined();
+        }));
+  };
+  auto scheduleWork = [&](std::string name) {
+    runtimeScheduler_->scheduleWork(
+        [&calls, name](jsi::Runtime const &) { calls.push_back(name); });
+  };
+
+  // A callback submitted before the work loop was requested runs first.
+  scheduleWork("work 1");
+  scheduleTask("task 1");
+  EXPECT_EQ(stubQueue_->size(), 2);
+
+  // A callback submitted after the work loop was requested joins the pending
+  // batch, so it runs before the work loop too.
+  scheduleWork("work 2");
+  EXPECT_EQ(stubQueue_->size(), 2);
+
+  stubQueue_->flush();
+
+  EXPECT_EQ(calls, (std::vector<std::string>{"work 1", "work 2", "task 1"}));
+
+  // Without a pending batch, a callback never runs before the work loop
+  // requested earlier.
+  calls.clear();
+  scheduleTask("task 2");
+  scheduleWork("work 3");
+  EXPECT_EQ(stubQueue_->size(), 2);
+
+  stubQueue_->flush();
+
+  EXPECT_EQ(calls, (std::vector<std::string>{"task 2", "work 3"}));
+}
+
 TEST_F(RuntimeSchedulerTest, normalTaskYieldsToPlatformEvent) {
   bool didRunJavaScriptTask = false;
   bool didRunPlatformWork = false;
@@ -636,4 +752,282 @@ TEST_F(RuntimeSchedulerTest, twoThreadsRequestAccessToTheRuntime) {
   EXPECT_FALSE(runtimeScheduler_->getShouldYield());
 }
 
+TEST_F(RuntimeSchedulerTest, normalTasksYieldWhenTimeSliceIsOver) {
+  runtimeScheduler_->setEnableTimeSlicing(true);
+  runtimeScheduler_->setTimeSliceDuration(5ms);
+
+  uint numberOfExecutedTasks = 0;
+  for (int i = 0; i < 4; i++) {
+    auto callback = createHostFunctionFromLambda([&](bool) {
+      numberOfExecutedTasks++;
+      stubClock_->advanceTimeBy(3ms);
+      return jsi::Value::undefined();
+    });
+    runtimeScheduler_->scheduleTask(
+        SchedulerPriority::NormalPriority, std::move(callback));
+  }
+
+  EXPECT_EQ(stubQueue_->size(), 1);
+
+  stubQueue_->tick();
+
+  // The second task exceeds the time slice, the rest continues in a
+  // subsequently scheduled run of the work loop.
+  EXPECT_EQ(numberOfExecutedTasks, 2);
+  EXPECT_EQ(stubQueue_->size(), 1);
+
+  stubQueue_->tick();
+
+  EXPECT_EQ(numberOfExecutedTasks, 4);
+  EXPECT_EQ(stubQueue_->size(), 0);
+
+  auto statistics = runtimeScheduler_->getTimeSliceStatistics();
+  EXPECT_EQ(statistics.numberOfSlices, 2);
+  EXPECT_EQ(statistics.numberOfYields, 1);
+  EXPECT_EQ(statistics.totalSliceDuration, 12ms);
+  EXPECT_EQ(statistics.longestSliceDuration, 6ms);
+  EXPECT_EQ(statistics.elapsedDuration, 12ms);
+  EXPECT_DOUBLE_EQ(statistics.yieldsPerSecond(), 1 / 0.012);
+
+  runtimeScheduler_->resetTimeSliceStatistics();
+
+  statistics = runtimeScheduler_->getTimeSliceStatistics();
+  EXPECT_EQ(statistics.numberOfSlices, 0);
+  EXPECT_EQ(statistics.numberOfYields, 0);
+  EXPECT_EQ(statistics.elapsedDuration, 0ms);
+}
+
+TEST_F(RuntimeSchedulerTest, getShouldYieldWhenTimeSliceIsOver) {
+  runtimeScheduler_->setEnableTimeSlicing(true);
+
+  auto shouldYieldBeforeDeadline = true;
+  auto shouldYieldAfterDeadline = false;
+  auto callback = createHostFunctionFromLambda([&](bool) {
+    stubClock_->advanceTimeBy(
+        RuntimeScheduler::kDefaultTimeSliceDuration - 1ms);
+    shouldYieldBeforeDeadline = runtimeScheduler_->getShouldYield();
+    stubClock_->advanceTimeBy(1ms);
+    shouldYieldAfterDeadline = runtimeScheduler_->getShouldYield();
+    return jsi::Value::undefined();
+  });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback));
+
+  stubQueue_->tick();
+
+  EXPECT_FALSE(shouldYieldBeforeDeadline);
+  EXPECT_TRUE(shouldYieldAfterDeadline);
+
+  // Outside of the work loop there is no time slice.
+  EXPECT_FALSE(runtimeScheduler_->getShouldYield());
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
+TEST_F(RuntimeSchedulerTest, delayedTaskWakesUpWorkLoop) {
+  std::vector<RuntimeSchedulerDuration> requestedDelays;
+  std::function<void()> wakeUp;
+  runtimeScheduler_->setTimer(
+      [&](RuntimeSchedulerDuration delay, std::function<void()> callback) {
+        requestedDelays.push_back(delay);
+        wakeUp = std::move(callback);
+      });
+
+  bool didRunTask = false;
+  auto callback = createHostFunctionFromLambda([&](bool) {
+    didRunTask = true;
+    return jsi::Value::undefined();
+  });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback), 10ms);
+
+  EXPECT_EQ(stubQueue_->size(), 0);
+  EXPECT_EQ(requestedDelays, std::vector<RuntimeSchedulerDuration>{10ms});
+
+  // The work loop runs for other reasons before the task is due.
+  stubClock_->advanceTimeBy(9ms);
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority,
+      createHostFunctionFromLambda(
+          [](bool) { return jsi::Value::undefined(); }));
+  stubQueue_->tick();
+
+  EXPECT_FALSE(didRunTask);
+  EXPECT_EQ(requestedDelays.size(), 1);
+
+  stubClock_->advanceTimeBy(1ms);
+  wakeUp();
+
+  EXPECT_EQ(stubQueue_->size(), 1);
+
+  stubQueue_->tick();
+
+  EXPECT_TRUE(didRunTask);
+  EXPECT_EQ(stubQueue_->size(), 0);
+  EXPECT_EQ(hostFunctionCallCount_, 2);
+}
+
+TEST_F(RuntimeSchedulerTest, delayedTaskWithoutTimerUsesTimerThread) {
+  bool didRunTask = false;
+  auto callback = createHostFunctionFromLambda([&](bool) {
+    didRunTask = true;
+    return jsi::Value::undefined();
+  });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback), 1ms);
+
+  EXPECT_EQ(stubQueue_->size(), 0);
+
+  // The built-in timer thread wakes the work loop up.
+  stubClock_->advanceTimeBy(1ms);
+  EXPECT_TRUE(stubQueue_->waitForTask(1s));
+
+  stubQueue_->tick();
+
+  EXPECT_TRUE(didRunTask);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
+TEST_F(RuntimeSchedulerTest, cancelledDelayedTaskIsRemoved) {
+  std::vector<RuntimeSchedulerDuration> requestedDelays;
+  runtimeScheduler_->setTimer(
+      [&](RuntimeSchedulerDuration delay, std::function<void()>) {
+        requestedDelays.push_back(delay);
+      });
+
+  bool didRunTask = false;
+  auto callback = createHostFunctionFromLambda([&](bool) {
+    didRunTask = true;
+    return jsi::Value::undefined();
+  });
+
+  auto task = runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback), 10ms);
+  std::weak_ptr<Task> weakTask = task;
+
+  runtimeScheduler_->cancelTask(*task);
+  task.reset();
+
+  // The scheduler doesn't retain the cancelled task.
+  EXPECT_TRUE(weakTask.expired());
+
+  stubClock_->advanceTimeBy(10ms);
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority,
+      createHostFunctionFromLambda(
+          [](bool) { return jsi::Value::undefined(); }));
+  stubQueue_->tick();
+
+  EXPECT_FALSE(didRunTask);
+  EXPECT_EQ(hostFunctionCallCount_, 1);
+}
+
+TEST_F(RuntimeSchedulerTest, delayedTasksShareWakeUps) {
+  std::vector<RuntimeSchedulerDuration> requestedDelays;
+  runtimeScheduler_->setTimer(
+      [&](RuntimeSchedulerDuration delay, std::function<void()>) {
+        requestedDelays.push_back(delay);
+      });
+
+  auto scheduleDelayedTask = [&](RuntimeSchedulerDuration delay) {
+    runtimeScheduler_->scheduleTask(
+        SchedulerPriority::NormalPriority,
+        createHostFunctionFromLambda(
+            [](bool) { return jsi::Value::undefined(); }),
+        delay);
+  };
+
+  scheduleDelayedTask(30ms);
+  scheduleDelayedTask(10ms);
+  scheduleDelayedTask(20ms);
+  scheduleDelayedTask(10ms);
+
+  // Only an earlier task requires an earlier wake-up.
+  EXPECT_EQ(
+      requestedDelays, (std::vector<RuntimeSchedulerDuration>{30ms, 10ms}));
+
+  stubClock_->advanceTimeBy(30ms);
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority,
+      createHostFunctionFromLambda(
+          [](bool) { return jsi::Value::undefined(); }));
+  stubQueue_->flush();
+
+  EXPECT_EQ(hostFunctionCallCount_, 5);
+  EXPECT_EQ(requestedDelays.size(), 2);
+}
+
+TEST_F(RuntimeSchedulerTest, idleTaskRunsOnlyWhenTimeSliceHasTimeLeft) {
+  runtimeScheduler_->setEnableTimeSlicing(true);
+
+  bool didRunNormalTask = false;
+  bool didRunIdleTask = false;
+
+  auto idleCallback = createHostFunctionFromLambda([&](bool) {
+    didRunIdleTask = true;
+    EXPECT_TRUE(didRunNormalTask);
+    EXPECT_EQ(
+        runtimeScheduler_->getCurrentPriorityLevel(),
+        SchedulerPriority::IdlePriority);
+    return jsi::Value::undefined();
+  });
+
+  auto normalCallback = createHostFunctionFromLambda([&](bool) {
+    didRunNormalTask = true;
+    stubClock_->advanceTimeBy(RuntimeScheduler::kDefaultTimeSliceDuration);
+    return jsi::Value::undefined();
+  });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::IdlePriority, std::move(idleCallback));
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(normalCallback));
+
+  EXPECT_EQ(stubQueue_->size(), 1);
+
+  stubQueue_->tick();
+
+  // The normal task used up the time slice.
+  EXPECT_TRUE(didRunNormalTask);
+  EXPECT_FALSE(didRunIdleTask);
+  EXPECT_EQ(stubQueue_->size(), 1);
+
+  stubQueue_->tick();
+
+  EXPECT_TRUE(didRunIdleTask);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
+TEST_F(RuntimeSchedulerTest, idleTaskIgnoresTimeSliceWithoutTimeSlicing) {
+  bool didRunNormalTask = false;
+  bool didRunIdleTask = false;
+
+  auto idleCallback = createHostFunctionFromLambda([&](bool) {
+    didRunIdleTask = true;
+    EXPECT_TRUE(didRunNormalTask);
+    return jsi::Value::undefined();
+  });
+
+  auto normalCallback = createHostFunctionFromLambda([&](bool) {
+    didRunNormalTask = true;
+    stubClock_->advanceTimeBy(RuntimeScheduler::kDefaultTimeSliceDuration);
+    return jsi::Value::undefined();
+  });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::IdlePriority, std::move(idleCallback));
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(normalCallback));
+
+  EXPECT_EQ(stubQueue_->size(), 1);
+
+  stubQueue_->tick();
+
+  EXPECT_TRUE(didRunNormalTask);
+  EXPECT_TRUE(didRunIdleTask);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
 } // namespace facebook::react
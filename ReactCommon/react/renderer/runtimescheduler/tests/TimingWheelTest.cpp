@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/API/hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/runtimescheduler/TimingWheel.h>
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+using namespace std::chrono_literals;
+
+class TimingWheelTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    runtime_ = facebook::hermes::makeHermesRuntime();
+    timingWheel_ = std::make_unique<TimingWheel>(origin_);
+  }
+
+  std::shared_ptr<Task> createTask() {
+    auto callback = jsi::Function::createFromHostFunction(
+        *runtime_,
+        jsi::PropNameID::forUtf8(*runtime_, ""),
+        0,
+        [](jsi::Runtime &, jsi::Value const &, jsi::Value const *, size_t) {
+          return jsi::Value::undefined();
+        });
+    return Task::create(
+        SchedulerPriority::NormalPriority, std::move(callback), origin_);
+  }
+
+  std::vector<std::shared_ptr<Task>> advance(RuntimeSchedulerDuration time) {
+    auto dueTasks = std::vector<std::shared_ptr<Task>>{};
+    timingWheel_->advance(origin_ + time, dueTasks);
+    return dueTasks;
+  }
+
+  RuntimeSchedulerTimePoint const origin_{};
+  std::unique_ptr<facebook::hermes::HermesRuntime> runtime_;
+  std::unique_ptr<TimingWheel> timingWheel_;
+};
+
+TEST_F(TimingWheelTest, emptyWheel) {
+  EXPECT_TRUE(timingWheel_->empty());
+  EXPECT_EQ(timingWheel_->size(), 0);
+  EXPECT_FALSE(timingWheel_->getNextDueTime().has_value());
+  EXPECT_TRUE(advance(1h).empty());
+}
+
+TEST_F(TimingWheelTest, tasksBecomeDueInOrder) {
+  auto firstTask = createTask();
+  auto secondTask = createTask();
+  auto thirdTask = createTask();
+
+  timingWheel_->insert(thirdTask, origin_ + 30ms);
+  timingWheel_->insert(firstTask, origin_ + 10ms);
+  timingWheel_->insert(secondTask, origin_ + 20ms);
+
+  EXPECT_EQ(timingWheel_->size(), 3);
+  EXPECT_TRUE(advance(9ms).empty());
+
+  auto dueTasks = advance(30ms);
+
+  EXPECT_EQ(
+      dueTasks,
+      (std::vector<std::shared_ptr<Task>>{firstTask, secondTask, thirdTask}));
+  EXPECT_TRUE(timingWheel_->empty());
+}
+
+TEST_F(TimingWheelTest, taskDoesNotBecomeDueEarly) {
+  auto task = createTask();
+
+  // Due times are rounded up to the next millisecond.
+  timingWheel_->insert(task, origin_ + 1500us);
+
+  EXPECT_TRUE(advance(1ms).empty());
+  EXPECT_EQ(advance(2ms), (std::vector<std::shared_ptr<Task>>{task}));
+}
+
+TEST_F(TimingWheelTest, taskDueInThePastBecomesDueRightAway) {
+  advance(100ms);
+
+  auto task = createTask();
+  timingWheel_->insert(task, origin_ + 50ms);
+
+  EXPECT_EQ(timingWheel_->getNextDueTime(), origin_ + 100ms);
+  EXPECT_EQ(advance(100ms), (std::vector<std::shared_ptr<Task>>{task}));
+}
+
+TEST_F(TimingWheelTest, tasksWrapAroundLevels) {
+  // Due at the first tick of the second, third and fourth level, and in the
+  // middle of a slot of the fourth level.
+  auto dueTimes = std::vector<RuntimeSchedulerDuration>{
+      64ms, 4096ms, 262144ms, 262144ms * 5 + 4096ms * 3 + 64ms * 2 + 1ms};
+
+  auto tasks = std::vector<std::shared_ptr<Task>>{};
+  for (auto dueTime : dueTimes) {
+    tasks.push_back(createTask());
+    timingWheel_->insert(tasks.back(), origin_ + dueTime);
+  }
+
+  for (size_t index = 0; index < dueTimes.size(); index++) {
+    EXPECT_TRUE(advance(dueTimes[index] - 1ms).empty());
+
+    auto nextDueTime = timingWheel_->getNextDueTime();
+    ASSERT_TRUE(nextDueTime.has_value());
+    EXPECT_LE(*nextDueTime, origin_ + dueTimes[index]);
+
+    EXPECT_EQ(
+        advance(dueTimes[index]),
+        (std::vector<std::shared_ptr<Task>>{tasks[index]}));
+  }
+
+  EXPECT_TRUE(timingWheel_->empty());
+}
+
+TEST_F(TimingWheelTest, tasksBeyondSpanAreKept) {
+  // The wheel spans 2^24 milliseconds.
+  auto span = RuntimeSchedulerDuration(std::chrono::milliseconds(1 << 24));
+  auto nearTask = createTask();
+  auto farTask = createTask();
+  auto farthestTask = createTask();
+
+  timingWheel_->insert(farthestTask, origin_ + span * 2 + 10ms);
+  timingWheel_->insert(farTask, origin_ + span + 10ms);
+  timingWheel_->insert(nearTask, origin_ + 10ms);
+
+  EXPECT_EQ(advance(10ms), (std::vector<std::shared_ptr<Task>>{nearTask}));
+  EXPECT_TRUE(advance(span).empty());
+  EXPECT_EQ(timingWheel_->size(), 2);
+
+  EXPECT_EQ(
+      advance(span + 10ms), (std::vector<std::shared_ptr<Task>>{farTask}));
+  EXPECT_TRUE(advance(span * 2 + 9ms).empty());
+  EXPECT_EQ(
+      advance(span * 2 + 10ms),
+      (std::vector<std::shared_ptr<Task>>{farthestTask}));
+  EXPECT_TRUE(timingWheel_->empty());
+}
+
+TEST_F(TimingWheelTest, removedTaskDoesNotBecomeDue) {
+  auto keptTask = createTask();
+  auto removedTask = createTask();
+  auto farRemovedTask = createTask();
+
+  timingWheel_->insert(keptTask, origin_ + 10ms);
+  timingWheel_->insert(removedTask, origin_ + 10ms);
+  timingWheel_->insert(farRemovedTask, origin_ + 1h);
+
+  EXPECT_TRUE(timingWheel_->remove(*removedTask));
+  EXPECT_EQ(timingWheel_->size(), 2);
+
+  // A task which was moved to a finer level can be removed as well.
+  EXPECT_EQ(advance(10ms), (std::vector<std::shared_ptr<Task>>{keptTask}));
+  EXPECT_TRUE(advance(1h - 1s).empty());
+  EXPECT_TRUE(timingWheel_->remove(*farRemovedTask));
+
+  EXPECT_TRUE(timingWheel_->empty());
+  EXPECT_FALSE(timingWheel_->getNextDueTime().has_value());
+  EXPECT_TRUE(advance(2h).empty());
+
+  // Tasks which are not (or no longer) in the wheel are not removed.
+  EXPECT_FALSE(timingWheel_->remove(*removedTask));
+  EXPECT_FALSE(timingWheel_->remove(*keptTask));
+}
+
+TEST_F(TimingWheelTest, removedTaskCanBeInsertedAgain) {
+  auto task = createTask();
+
+  timingWheel_->insert(task, origin_ + 10ms);
+  EXPECT_TRUE(timingWheel_->remove(*task));
+
+  timingWheel_->insert(task, origin_ + 20ms);
+
+  EXPECT_TRUE(advance(10ms).empty());
+  EXPECT_EQ(advance(20ms), (std::vector<std::shared_ptr<Task>>{task}));
+}
+
+} // namespace facebook::react
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/API/hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+enum class TraceOperation { Schedule, Cancel, RunWorkLoop };
+
+struct TraceEntry {
+  TraceOperation operation;
+  SchedulerPriority priority;
+  /*
+   * For `Cancel`: index of the cancelled task among all scheduled tasks.
+   */
+  size_t taskIndex;
+};
+
+/*
+ * A schedule/cancel trace shaped after React transitions: bursts of
+ * scheduled updates most of which are cancelled and rescheduled before the
+ * work loop gets to run.
+ */
+static std::vector<TraceEntry> const &transitionTrace() {
+  static auto const trace = [] {
+    auto trace = std::vector<TraceEntry>{};
+    auto random = std::mt19937{42};
+    auto numberOfScheduledTasks = size_t{0};
+    auto liveTasks = std::vector<size_t>{};
+
+    for (int burst = 0; burst < 200; burst++) {
+      auto burstSize = 20 + random() % 60;
+      for (size_t i = 0; i < burstSize; i++) {
+        auto priority = random() % 4 == 0
+            ? SchedulerPriority::UserBlockingPriority
+            : SchedulerPriority::NormalPriority;
+        trace.push_back({TraceOperation::Schedule, priority, 0});
+        liveTasks.push_back(numberOfScheduledTasks++);
+
+        // Most updates get superseded by a subsequent one.
+        if (liveTasks.size() > 1 && random() % 10 < 8) {
+          auto index = random() % (liveTasks.size() - 1);
+          trace.push_back(
+              {TraceOperation::Cancel,
+               SchedulerPriority::NormalPriority,
+               liveTasks[index]});
+          liveTasks.erase(liveTasks.begin() + index);
+        }
+      }
+      trace.push_back(
+          {TraceOperation::RunWorkLoop, SchedulerPriority::NormalPriority, 0});
+      liveTasks.clear();
+    }
+    return trace;
+  }();
+  return trace;
+}
+
+static void replayTransitionTrace(benchmark::State &state) {
+  auto runtime = facebook::hermes::makeHermesRuntime();
+  auto pendingWork = std::vector<std::function<void(jsi::Runtime &)>>{};
+  auto runtimeExecutor =
+      [&](std::function<void(jsi::Runtime & runtime)> &&callback) {
+        pendingWork.push_back(std::move(callback));
+      };
+  auto timePoint = RuntimeSchedulerTimePoint{};
+  auto runtimeScheduler =
+      RuntimeScheduler{runtimeExecutor, [&]() { return timePoint; }};
+
+  auto callback = jsi::Function::createFromHostFunction(
+      *runtime,
+      jsi::PropNameID::forAscii(*runtime, ""),
+      1,
+      [](jsi::Runtime &, jsi::Value const &, jsi::Value const *, size_t) {
+        return jsi::Value::undefined();
+      });
+
+  auto const &trace = transitionTrace();
+  auto tasks = std::vector<std::shared_ptr<Task>>{};
+
+  for (auto _ : state) {
+    tasks.clear();
+    for (auto const &entry : trace) {
+      switch (entry.operation) {
+        case TraceOperation::Schedule:
+          tasks.push_back(runtimeScheduler.scheduleTask(
+              entry.priority,
+              jsi::Value(*runtime, callback)
+                  .getObject(*runtime)
+                  .getFunction(*runtime)));
+          break;
+        case TraceOperation::Cancel:
+          runtimeScheduler.cancelTask(*tasks[entry.taskIndex]);
+          break;
+        case TraceOperation::RunWorkLoop:
+          while (!pendingWork.empty()) {
+            auto work = std::move(pendingWork.back());
+            pendingWork.pop_back();
+            work(*runtime);
+          }
+          break;
+      }
+      timePoint += std::chrono::microseconds(100);
+    }
+  }
+
+  state.counters["operations"] = benchmark::Counter(
+      static_cast<double>(trace.size()),
+      benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(replayTransitionTrace);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
@@ -25,6 +25,7 @@ void SurfaceTelemetry::incorporate(
   numberOfMutations_ += numberOfMutations;
   numberOfTextMeasurements_ += telemetry.getNumberOfTextMeasurements();
   lastRevisionNumber_ = telemetry.getRevisionNumber();
+  numberOfCompactedMutations_ += telemetry.getNumberOfCompactedMutations();
 
   while (recentTransactionTelemetries_.size() >=
          kMaxNumberOfRecordedCommitTelemetries) {
@@ -70,6 +71,20 @@ int SurfaceTelemetry::getLastRevisionNumber() const {
   return lastRevisionNumber_;
 }
 
+int SurfaceTelemetry::getNumberOfCompactedMutations() const {
+  return numberOfCompactedMutations_;
+}
+
+double SurfaceTelemetry::getCompactionRatio() const {
+  auto numberOfUncompactedMutations =
+      numberOfMutations_ + numberOfCompactedMutations_;
+  if (numberOfUncompactedMutations == 0) {
+    return 0;
+  }
+  return static_cast<double>(numberOfCompactedMutations_) /
+      numberOfUncompactedMutations;
+}
+
 std::vector<TransactionTelemetry>
 SurfaceTelemetry::getRecentTransactionTelemetries() const {
   auto result = std::vector<TransactionTelemetry>{};
@@ -37,6 +37,13 @@ class SurfaceTelemetry final {
   int getNumberOfMutations() const;
   int getNumberOfTextMeasurements() const;
   int getLastRevisionNumber() const;
+  int getNumberOfCompactedMutations() const;
+
+  /*
+   * The share of mutations (in the range [0, 1]) that mutation-list
+   * compaction removed before they reached the mounting layer.
+   */
+  double getCompactionRatio() const;
 
   std::vector<TransactionTelemetry> getRecentTransactionTelemetries() const;
 
@@ -59,6 +66,7 @@ class SurfaceTelemetry final {
   int numberOfMutations_{};
   int numberOfTextMeasurements_{};
   int lastRevisionNumber_{};
+  int numberOfCompactedMutations_{};
 
   butter::
       small_vector<TransactionTelemetry, kMaxNumberOfRecordedCommitTelemetries>
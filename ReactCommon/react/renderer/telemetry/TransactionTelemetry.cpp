@@ -101,6 +101,20 @@ void TransactionTelemetry::setRevisionNumber(int revisionNumber) {
   revisionNumber_ = revisionNumber;
 }
 
+void TransactionTelemetry::setNumberOfCompactedMutations(
+    int numberOfCompactedMutations) {
+  numberOfCompactedMutations_ = numberOfCompactedMutations;
+}
+
+void TransactionTelemetry::setNumberOfCommitRetries(int numberOfCommitRetries) {
+  numberOfCommitRetries_ = numberOfCommitRetries;
+}
+
+void TransactionTelemetry::setNumberOfMergedTransactions(
+    int numberOfMergedTransactions) {
+  numberOfMergedTransactions_ = numberOfMergedTransactions;
+}
+
 TelemetryTimePoint TransactionTelemetry::getDiffStartTime() const {
   react_native_assert(diffStartTime_ != kTelemetryUndefinedTimePoint);
   react_native_assert(diffEndTime_ != kTelemetryUndefinedTimePoint);
@@ -161,5 +175,17 @@ int TransactionTelemetry::getRevisionNumber() const {
   return revisionNumber_;
 }
 
+int TransactionTelemetry::getNumberOfCompactedMutations() const {
+  return numberOfCompactedMutations_;
+}
+
+int TransactionTelemetry::getNumberOfCommitRetries() const {
+  return numberOfCommitRetries_;
+}
+
+int TransactionTelemetry::getNumberOfMergedTransactions() const {
+  return numberOfMergedTransactions_;
+}
+
 } // namespace react
 } // namespace facebook
@@ -49,6 +49,24 @@ class TransactionTelemetry final {
 
   void setRevisionNumber(int revisionNumber);
 
+  /*
+   * The number of mutations that were removed from the transaction by
+   * mutation-list compaction (zero if compaction is disabled).
+   */
+  void setNumberOfCompactedMutations(int numberOfCompactedMutations);
+
+  /*
+   * The number of times the commit was re-run because another revision was
+   * committed concurrently.
+   */
+  void setNumberOfCommitRetries(int numberOfCommitRetries);
+
+  /*
+   * The number of queued transactions the revision combines (one unless
+   * the commit queue of `ShadowTree` is enabled).
+   */
+  void setNumberOfMergedTransactions(int numberOfMergedTransactions);
+
   /*
    * Reading
    */
@@ -64,6 +82,9 @@ class TransactionTelemetry final {
   TelemetryDuration getTextMeasureTime() const;
   int getNumberOfTextMeasurements() const;
   int getRevisionNumber() const;
+  int getNumberOfCompactedMutations() const;
+  int getNumberOfCommitRetries() const;
+  int getNumberOfMergedTransactions() const;
 
  private:
   TelemetryTimePoint diffStartTime_{kTelemetryUndefinedTimePoint};
@@ -80,6 +101,9 @@ class TransactionTelemetry final {
 
   int numberOfTextMeasurements_{0};
   int revisionNumber_{0};
+  int numberOfCompactedMutations_{0};
+  int numberOfCommitRetries_{0};
+  int numberOfMergedTransactions_{1};
   std::function<TelemetryTimePoint()> now_;
 };
 
@@ -10,6 +10,7 @@
 
 #include <gtest/gtest.h>
 
+#include <react/renderer/telemetry/SurfaceTelemetry.h>
 #include <react/renderer/telemetry/TransactionTelemetry.h>
 #include <react/test_utils/MockClock.h>
 #include <react/utils/Telemetry.h>
@@ -133,6 +134,34 @@ TEST(TransactionTelemetryTest, defaultImplementation) {
   EXPECT_GE(mountDuration, 100);
 }
 
+TEST(TransactionTelemetryTest, compactionRatio) {
+  auto surfaceTelemetry = SurfaceTelemetry{};
+  EXPECT_EQ(surfaceTelemetry.getCompactionRatio(), 0);
+
+  for (auto numberOfCompactedMutations : {0, 50}) {
+    auto telemetry = TransactionTelemetry{[]() { return MockClock::now(); }};
+    telemetry.willCommit();
+    telemetry.willLayout();
+    telemetry.didLayout();
+    telemetry.didCommit();
+    telemetry.willDiff();
+    telemetry.setNumberOfCompactedMutations(numberOfCompactedMutations);
+    telemetry.didDiff();
+    telemetry.willMount();
+    telemetry.didMount();
+
+    EXPECT_EQ(
+        telemetry.getNumberOfCompactedMutations(), numberOfCompactedMutations);
+
+    surfaceTelemetry.incorporate(telemetry, /* numberOfMutations */ 100);
+  }
+
+  // 50 of 250 mutations were removed.
+  EXPECT_EQ(surfaceTelemetry.getNumberOfMutations(), 200);
+  EXPECT_EQ(surfaceTelemetry.getNumberOfCompactedMutations(), 50);
+  EXPECT_DOUBLE_EQ(surfaceTelemetry.getCompactionRatio(), 0.2);
+}
+
 TEST(TransactionTelemetryTest, abnormalUseCases) {
   // Calling `did` before `will` should crash.
   EXPECT_DEATH_IF_SUPPORTED(
@@ -18,6 +18,7 @@
 
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <utility>
 
 namespace facebook::react {
@@ -221,26 +222,24 @@ ShadowTree::Unique UIManager::stopSurface(SurfaceId surfaceId) const {
   return shadowTree;
 }
 
+ShadowNodeAncestorIndex::Shared UIManager::getAncestorIndex(
+    SurfaceId surfaceId) const {
+  auto ancestorIndex = ShadowNodeAncestorIndex::Shared{};
+  shadowTreeRegistry_.visit(surfaceId, [&](ShadowTree const &shadowTree) {
+    ancestorIndex = shadowTree.getCurrentRevision().ancestorIndex;
+  });
+  return ancestorIndex;
+}
+
 ShadowNode::Shared UIManager::getNewestCloneOfShadowNode(
     ShadowNode const &shadowNode) const {
-  auto ancestorShadowNode = ShadowNode::Shared{};
-  shadowTreeRegistry_.visit(
-      shadowNode.getSurfaceId(), [&](ShadowTree const &shadowTree) {
-        ancestorShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
-      });
-
-  if (!ancestorShadowNode) {
-    return nullptr;
-  }
+  auto ancestorIndex = getAncestorIndex(shadowNode.getSurfaceId());
 
-  auto ancestors = shadowNode.getFamily().getAncestors(*ancestorShadowNode);
-
-  if (ancestors.empty()) {
+  if (!ancestorIndex) {
     return nullptr;
   }
 
-  auto pair = ancestors.rbegin();
-  return pair->first.get().getChildren().at(pair->second);
+  return ancestorIndex->findShadowNode(shadowNode.getFamily());
 }
 
 ShadowNode::Shared UIManager::findNodeAtPoint(
@@ -256,34 +255,105 @@ LayoutMetrics UIManager::getRelativeLayoutMetrics(
     LayoutableShadowNode::LayoutInspectingPolicy policy) const {
   SystraceSection s("UIManager::getRelativeLayoutMetrics");
 
+  auto ancestorIndex = getAncestorIndex(shadowNode.getSurfaceId());
+
+  if (!ancestorIndex) {
+    return EmptyLayoutMetrics;
+  }
+
+  return computeRelativeLayoutMetrics(
+      *ancestorIndex, shadowNode, ancestorShadowNode, policy);
+}
+
+std::vector<LayoutMetrics> UIManager::getRelativeLayoutMetrics(
+    std::vector<ShadowNode::Shared> const &shadowNodes,
+    ShadowNode const *ancestorShadowNode,
+    LayoutableShadowNode::LayoutInspectingPolicy policy,
+    std::vector<ShadowNode::Shared> *newestClonesOfShadowNodes) const {
+  SystraceSection s(
+      "UIManager::getRelativeLayoutMetrics", "size", shadowNodes.size());
+
+  auto layoutMetricsList = std::vector<LayoutMetrics>{};
+  layoutMetricsList.reserve(shadowNodes.size());
+  if (newestClonesOfShadowNodes) {
+    newestClonesOfShadowNodes->clear();
+    newestClonesOfShadowNodes->reserve(shadowNodes.size());
+  }
+
+  // The batch is grouped by surface first: the index of the current revision
+  // of every surface is retrieved once, even if the nodes of different
+  // surfaces are interleaved. Usually there is only one surface, so a linear
+  // search is the cheapest lookup.
+  auto ancestorIndices =
+      std::vector<std::pair<SurfaceId, ShadowNodeAncestorIndex::Shared>>{};
+  auto findAncestorIndex = [&](SurfaceId surfaceId) {
+    return std::find_if(
+        ancestorIndices.begin(), ancestorIndices.end(), [&](auto const &item) {
+          return item.first == surfaceId;
+        });
+  };
+
+  for (auto const &shadowNode : shadowNodes) {
+    auto surfaceId = shadowNode->getSurfaceId();
+    if (findAncestorIndex(surfaceId) == ancestorIndices.end()) {
+      ancestorIndices.emplace_back(surfaceId, getAncestorIndex(surfaceId));
+    }
+  }
+
+  for (auto const &shadowNode : shadowNodes) {
+    auto const &ancestorIndex =
+        findAncestorIndex(shadowNode->getSurfaceId())->second;
+
+    if (!ancestorIndex) {
+      layoutMetricsList.push_back(EmptyLayoutMetrics);
+      if (newestClonesOfShadowNodes) {
+        newestClonesOfShadowNodes->push_back(nullptr);
+      }
+      continue;
+    }
+
+    layoutMetricsList.push_back(computeRelativeLayoutMetrics(
+        *ancestorIndex, *shadowNode, ancestorShadowNode, policy));
+    if (newestClonesOfShadowNodes) {
+      newestClonesOfShadowNodes->push_back(
+          ancestorIndex->findShadowNode(shadowNode->getFamily()));
+    }
+  }
+
+  return layoutMetricsList;
+}
+
+LayoutMetrics UIManager::computeRelativeLayoutMetrics(
+    ShadowNodeAncestorIndex const &ancestorIndex,
+    ShadowNode const &shadowNode,
+    ShadowNode const *ancestorShadowNode,
+    LayoutableShadowNode::LayoutInspectingPolicy policy) const {
   // We might store here an owning pointer to `ancestorShadowNode` to ensure
   // that the node is not deallocated during method execution lifetime.
   auto owningAncestorShadowNode = ShadowNode::Shared{};
 
   if (!ancestorShadowNode) {
-    shadowTreeRegistry_.visit(
-        shadowNode.getSurfaceId(), [&](ShadowTree const &shadowTree) {
-          owningAncestorShadowNode =
-              shadowTree.getCurrentRevision().rootShadowNode;
-          ancestorShadowNode = owningAncestorShadowNode.get();
-        });
+    owningAncestorShadowNode = ancestorIndex.getRootShadowNode();
   } else {
     // It is possible for JavaScript (or other callers) to have a reference
     // to a previous version of ShadowNodes, but we enforce that
     // metrics are only calculated on most recently committed versions.
-    owningAncestorShadowNode = getNewestCloneOfShadowNode(*ancestorShadowNode);
-    ancestorShadowNode = owningAncestorShadowNode.get();
+    owningAncestorShadowNode =
+        ancestorIndex.findShadowNode(ancestorShadowNode->getFamily());
   }
 
   auto layoutableAncestorShadowNode =
-      traitCast<LayoutableShadowNode const *>(ancestorShadowNode);
+      traitCast<LayoutableShadowNode const *>(owningAncestorShadowNode.get());
 
   if (!layoutableAncestorShadowNode) {
     return EmptyLayoutMetrics;
   }
 
   return LayoutableShadowNode::computeRelativeLayoutMetrics(
-      shadowNode.getFamily(), *layoutableAncestorShadowNode, policy);
+      shadowNode.getFamily(),
+      *layoutableAncestorShadowNode,
+      policy,
+      &ancestorIndex);
 }
 
 void UIManager::updateState(StateUpdate const &stateUpdate) const {
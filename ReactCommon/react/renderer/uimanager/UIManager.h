@@ -15,6 +15,7 @@
 #include <react/renderer/componentregistry/ComponentDescriptorRegistry.h>
 #include <react/renderer/core/RawValue.h>
 #include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/core/ShadowNodeAncestorIndex.h>
 #include <react/renderer/core/StateData.h>
 #include <react/renderer/leakchecker/LeakChecker.h>
 #include <react/renderer/mounting/ShadowTree.h>
@@ -159,6 +160,32 @@ class UIManager final : public ShadowTreeDelegate {
       ShadowNode const *ancestorShadowNode,
       LayoutableShadowNode::LayoutInspectingPolicy policy) const;
 
+  /*
+   * Batched version of the method above: measures all given nodes against
+   * the same (current) revision of their shadow tree, sharing the ancestor
+   * index of the revision among all queries. If `newestClonesOfShadowNodes`
+   * is provided, it's filled with the newest clones of the given nodes in
+   * that revision (`nullptr` for nodes which are not a part of it).
+   */
+  std::vector<LayoutMetrics> getRelativeLayoutMetrics(
+      std::vector<ShadowNode::Shared> const &shadowNodes,
+      ShadowNode const *ancestorShadowNode,
+      LayoutableShadowNode::LayoutInspectingPolicy policy,
+      std::vector<ShadowNode::Shared> *newestClonesOfShadowNodes =
+          nullptr) const;
+
+  /*
+   * Returns the ancestor index of the current revision of the shadow tree
+   * of the given surface, or `nullptr` if there is no such surface.
+   */
+  ShadowNodeAncestorIndex::Shared getAncestorIndex(SurfaceId surfaceId) const;
+
+  LayoutMetrics computeRelativeLayoutMetrics(
+      ShadowNodeAncestorIndex const &ancestorIndex,
+      ShadowNode const &shadowNode,
+      ShadowNode const *ancestorShadowNode,
+      LayoutableShadowNode::LayoutInspectingPolicy policy) const;
+
   /*
    * Creates a new shadow node with given state data, clones what's necessary
    * and performs a commit.
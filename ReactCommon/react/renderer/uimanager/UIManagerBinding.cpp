@@ -15,12 +15,60 @@
 #include <react/renderer/runtimescheduler/RuntimeSchedulerBinding.h>
 #include <react/renderer/uimanager/primitives.h>
 
+#include <cmath>
+#include <limits>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "bindingUtils.h"
 
 namespace facebook::react {
 
+// Number of items describing a node in the `nodes` array of `createNodes`.
+static constexpr size_t kCreateNodesStride = 5;
+
+/*
+ * Returns `value` (an item of the input of `createNodes`) as an index into a
+ * list of `size` items. Throws a `jsi::JSError` if it is not one (casting a
+ * negative or non-finite number to `size_t` is undefined).
+ */
+static size_t createNodesIndexFromValue(
+    jsi::Runtime &runtime,
+    jsi::Value const &value,
+    size_t size) {
+  if (value.isNumber()) {
+    auto number = value.getNumber();
+    if (number >= 0 && number < static_cast<double>(size) &&
+        number == std::floor(number)) {
+      return static_cast<size_t>(number);
+    }
+  }
+  throw jsi::JSError(
+      runtime,
+      "createNodes: an index is not an index of a preceding node: " +
+          (value.isNumber() ? std::to_string(value.getNumber())
+                            : std::string{"(not a number)"}));
+}
+
+/*
+ * Returns `value` (an item of the input of `createNodes`) as a tag. Throws a
+ * `jsi::JSError` if it is not an integer representable as `Tag`.
+ */
+static Tag createNodesTagFromValue(
+    jsi::Runtime &runtime,
+    jsi::Value const &value) {
+  if (value.isNumber()) {
+    auto number = value.getNumber();
+    if (number >= std::numeric_limits<Tag>::min() &&
+        number <= std::numeric_limits<Tag>::max() &&
+        number == std::floor(number)) {
+      return static_cast<Tag>(number);
+    }
+  }
+  throw jsi::JSError(runtime, "createNodes: a tag is not an integer.");
+}
+
 void UIManagerBinding::createAndInstallIfNeeded(
     jsi::Runtime &runtime,
     RuntimeExecutor const &runtimeExecutor,
@@ -147,6 +195,34 @@ void UIManagerBinding::invalidate() const {
 jsi::Value UIManagerBinding::get(
     jsi::Runtime &runtime,
     jsi::PropNameID const &name) {
+  // Decorated runtimes might access the binding too; values created for one
+  // runtime must not be returned to another one, so only the first runtime
+  // gets the cache.
+  if (cacheRuntime_ == nullptr) {
+    cacheRuntime_ = &runtime;
+  }
+
+  if (cacheRuntime_ != &runtime) {
+    return createValue(runtime, name);
+  }
+
+  for (auto const &item : cache_) {
+    if (jsi::PropNameID::compare(runtime, item.name, name)) {
+      return jsi::Value(runtime, item.value);
+    }
+  }
+
+  auto value = createValue(runtime, name);
+  if (!value.isUndefined()) {
+    cache_.push_back(
+        {jsi::PropNameID(runtime, name), jsi::Value(runtime, value)});
+  }
+  return value;
+}
+
+jsi::Value UIManagerBinding::createValue(
+    jsi::Runtime &runtime,
+    jsi::PropNameID const &name) {
   auto methodName = name.utf8(runtime);
   SystraceSection s("UIManagerBinding::get", "name", methodName);
 
@@ -207,6 +283,142 @@ jsi::Value UIManagerBinding::get(
         });
   }
 
+  // Semantic: Creates a batch of new nodes (and appends them to each other)
+  // in one call. Arguments are `rootTag`, `nodes` (a flat array of
+  // `[tag, viewName, props, instanceHandle, childIndices]` quintuples where
+  // `childIndices` is `null` or an array of indices of nodes described
+  // *earlier* in the batch), and optional `indices` of nodes JavaScript needs
+  // wrappers for. Returns an array of wrappers of the nodes at `indices` (or,
+  // if `indices` is `undefined`, of the nodes which are not children of other
+  // nodes of the batch).
+  if (methodName == "createNodes") {
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        name,
+        3,
+        [uiManager](
+            jsi::Runtime &runtime,
+            jsi::Value const &thisValue,
+            jsi::Value const *arguments,
+            size_t count) -> jsi::Value {
+          SystraceSection s("UIManagerBinding::createNodes");
+
+          if (count < 2) {
+            throw jsi::JSError(
+                runtime, "createNodes: `surfaceId` and `nodes` are required.");
+          }
+
+          auto surfaceId = surfaceIdFromValue(runtime, arguments[0]);
+          auto nodes = arguments[1].asObject(runtime).asArray(runtime);
+          auto nodesSize = nodes.size(runtime);
+          if (nodesSize % kCreateNodesStride != 0) {
+            throw jsi::JSError(
+                runtime,
+                "createNodes: the length of `nodes` is not a multiple of " +
+                    std::to_string(kCreateNodesStride) + ".");
+          }
+          auto numberOfNodes = nodesSize / kCreateNodesStride;
+
+          auto values = std::vector<jsi::Value>{};
+          values.reserve(nodesSize);
+          for (size_t i = 0; i < nodesSize; i++) {
+            values.push_back(nodes.getValueAtIndex(runtime, i));
+          }
+
+          // The whole input is validated before any node is created, so
+          // malformed input throws without creating some of the nodes.
+          auto tags = std::vector<Tag>{};
+          tags.reserve(numberOfNodes);
+          // Children of node `i` are the nodes at `childIndices[j]` for `j` in
+          // `[childIndicesOffsets[i], childIndicesOffsets[i + 1])`.
+          auto childIndices = std::vector<size_t>{};
+          auto childIndicesOffsets = std::vector<size_t>{0};
+          childIndicesOffsets.reserve(numberOfNodes + 1);
+          auto isChild = std::vector<bool>(numberOfNodes);
+
+          for (size_t index = 0; index < numberOfNodes; index++) {
+            auto offset = index * kCreateNodesStride;
+            tags.push_back(createNodesTagFromValue(runtime, values[offset]));
+            if (!values[offset + 1].isString()) {
+              throw jsi::JSError(
+                  runtime, "createNodes: a view name is not a string.");
+            }
+            if (!values[offset + 2].isObject() &&
+                !values[offset + 2].isNull()) {
+              throw jsi::JSError(
+                  runtime, "createNodes: props are not an object.");
+            }
+            if (!values[offset + 3].isObject()) {
+              throw jsi::JSError(
+                  runtime, "createNodes: an instance handle is not an object.");
+            }
+
+            auto const &childIndicesValue = values[offset + 4];
+            if (childIndicesValue.isObject()) {
+              auto array =
+                  childIndicesValue.getObject(runtime).asArray(runtime);
+              auto size = array.size(runtime);
+              for (size_t i = 0; i < size; i++) {
+                // Children must be described before their parents.
+                auto childIndex = createNodesIndexFromValue(
+                    runtime, array.getValueAtIndex(runtime, i), index);
+                childIndices.push_back(childIndex);
+                isChild[childIndex] = true;
+              }
+            }
+            childIndicesOffsets.push_back(childIndices.size());
+          }
+
+          auto indices = std::vector<size_t>{};
+          if (count > 2 && arguments[2].isObject()) {
+            auto array = arguments[2].getObject(runtime).asArray(runtime);
+            auto size = array.size(runtime);
+            indices.reserve(size);
+            for (size_t i = 0; i < size; i++) {
+              indices.push_back(createNodesIndexFromValue(
+                  runtime, array.getValueAtIndex(runtime, i), numberOfNodes));
+            }
+          } else {
+            for (size_t index = 0; index < numberOfNodes; index++) {
+              if (!isChild[index]) {
+                indices.push_back(index);
+              }
+            }
+          }
+
+          auto shadowNodes = std::vector<ShadowNode::Shared>{};
+          shadowNodes.reserve(numberOfNodes);
+
+          for (size_t index = 0; index < numberOfNodes; index++) {
+            auto offset = index * kCreateNodesStride;
+            auto shadowNode = uiManager->createNode(
+                tags[index],
+                stringFromValue(runtime, values[offset + 1]),
+                surfaceId,
+                RawProps(runtime, values[offset + 2]),
+                std::make_shared<EventTarget>(
+                    runtime, values[offset + 3], tags[index]));
+
+            for (auto i = childIndicesOffsets[index];
+                 i < childIndicesOffsets[index + 1];
+                 i++) {
+              uiManager->appendChild(shadowNode, shadowNodes[childIndices[i]]);
+            }
+
+            shadowNodes.push_back(std::move(shadowNode));
+          }
+
+          auto result = jsi::Array(runtime, indices.size());
+          for (size_t i = 0; i < indices.size(); i++) {
+            result.setValueAtIndex(
+                runtime,
+                i,
+                valueFromShadowNode(runtime, shadowNodes[indices[i]]));
+          }
+          return std::move(result);
+        });
+  }
+
   // Semantic: Clones the node with *same* props and *same* children.
   if (methodName == "cloneNode") {
     return jsi::Function::createFromHostFunction(
@@ -383,6 +595,30 @@ jsi::Value UIManagerBinding::get(
         });
   }
 
+  // Semantic: Appends all nodes of a given array to the child set in one call.
+  if (methodName == "appendChildrenToSet") {
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        name,
+        2,
+        [](jsi::Runtime &runtime,
+           jsi::Value const &thisValue,
+           jsi::Value const *arguments,
+           size_t count) -> jsi::Value {
+          auto shadowNodeList = shadowNodeListFromValue(runtime, arguments[0]);
+          auto array = arguments[1].asObject(runtime).asArray(runtime);
+          auto size = array.size(runtime);
+          shadowNodeList->reserve(shadowNodeList->size() + size);
+          for (size_t i = 0; i < size; i++) {
+            shadowNodeList->push_back(childShadowNodeFromValue(
+                runtime, array.getValueAtIndex(runtime, i)));
+          }
+          return jsi::Value::undefined();
+        });
+  }
+
+  // Semantic: Commits the given children (a child set or an array of nodes)
+  // as children of the root node of the surface.
   if (methodName == "completeRoot") {
     std::weak_ptr<UIManager> weakUIManager = uiManager_;
     // Enhanced version of the method that uses `backgroundExecutor` and
@@ -395,7 +631,7 @@ jsi::Value UIManagerBinding::get(
             jsi::Runtime &runtime,
             jsi::Value const &thisValue,
             jsi::Value const *arguments,
-            size_t count) noexcept -> jsi::Value {
+            size_t count) -> jsi::Value {
           auto runtimeSchedulerBinding =
               RuntimeSchedulerBinding::getBinding(runtime);
           auto surfaceId = surfaceIdFromValue(runtime, arguments[0]);
@@ -584,6 +820,76 @@ jsi::Value UIManagerBinding::get(
         });
   }
 
+  // Batched version of `measure`: all nodes are measured against the same
+  // revision of the tree. The callback receives an array of
+  // `[x, y, width, height, pageX, pageY]` arrays, one for every node.
+  if (methodName == "measureMany") {
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        name,
+        2,
+        [uiManager](
+            jsi::Runtime &runtime,
+            jsi::Value const &thisValue,
+            jsi::Value const *arguments,
+            size_t count) noexcept -> jsi::Value {
+          auto shadowNodeArray =
+              arguments[0].getObject(runtime).getArray(runtime);
+          auto size = shadowNodeArray.size(runtime);
+
+          auto shadowNodes = std::vector<ShadowNode::Shared>{};
+          shadowNodes.reserve(size);
+          for (size_t i = 0; i < size; i++) {
+            shadowNodes.push_back(shadowNodeFromValue(
+                runtime, shadowNodeArray.getValueAtIndex(runtime, i)));
+          }
+
+          auto newestClonesOfShadowNodes = std::vector<ShadowNode::Shared>{};
+          auto layoutMetricsList = uiManager->getRelativeLayoutMetrics(
+              shadowNodes,
+              nullptr,
+              {/* .includeTransform = */ true},
+              &newestClonesOfShadowNodes);
+
+          auto result = jsi::Array(runtime, size);
+          for (size_t i = 0; i < size; i++) {
+            auto const &layoutMetrics = layoutMetricsList[i];
+            if (layoutMetrics == EmptyLayoutMetrics) {
+              result.setValueAtIndex(
+                  runtime,
+                  i,
+                  jsi::Array::createWithElements(runtime, 0, 0, 0, 0, 0, 0));
+              continue;
+            }
+
+            auto layoutableShadowNode =
+                traitCast<LayoutableShadowNode const *>(
+                    newestClonesOfShadowNodes[i].get());
+            Point originRelativeToParent = layoutableShadowNode
+                ? layoutableShadowNode->getLayoutMetrics().frame.origin
+                : Point();
+
+            auto frame = layoutMetrics.frame;
+            result.setValueAtIndex(
+                runtime,
+                i,
+                jsi::Array::createWithElements(
+                    runtime,
+                    {jsi::Value{runtime, (double)originRelativeToParent.x},
+                     jsi::Value{runtime, (double)originRelativeToParent.y},
+                     jsi::Value{runtime, (double)frame.size.width},
+                     jsi::Value{runtime, (double)frame.size.height},
+                     jsi::Value{runtime, (double)frame.origin.x},
+                     jsi::Value{runtime, (double)frame.origin.y}}));
+          }
+
+          auto onSuccessFunction =
+              arguments[1].getObject(runtime).getFunction(runtime);
+          onSuccessFunction.call(runtime, std::move(result));
+          return jsi::Value::undefined();
+        });
+  }
+
   if (methodName == "measureInWindow") {
     return jsi::Function::createFromHostFunction(
         runtime,
@@ -14,6 +14,8 @@
 #include <react/renderer/uimanager/UIManager.h>
 #include <react/renderer/uimanager/primitives.h>
 
+#include <vector>
+
 namespace facebook::react {
 
 /*
@@ -69,15 +71,35 @@ class UIManagerBinding : public jsi::HostObject {
 
   /*
    * `jsi::HostObject` specific overloads.
+   * Values (mostly host functions) are created on first access and cached,
+   * so repeated accesses do not convert names to strings and do not allocate
+   * new host functions.
    */
   jsi::Value get(jsi::Runtime &runtime, jsi::PropNameID const &name) override;
 
  private:
+  struct CachedValue {
+    jsi::PropNameID name;
+    jsi::Value value;
+  };
+
+  /*
+   * Creates the value of the property with a given name.
+   */
+  jsi::Value createValue(jsi::Runtime &runtime, jsi::PropNameID const &name);
+
   std::shared_ptr<UIManager> uiManager_;
   std::unique_ptr<EventHandler const> eventHandler_;
   mutable ReactEventPriority currentEventPriority_;
 
   RuntimeExecutor runtimeExecutor_;
+
+  /*
+   * Values previously returned by `get` for `cacheRuntime_` (the first runtime
+   * the binding was accessed with). Accessed on the JavaScript thread only.
+   */
+  jsi::Runtime *cacheRuntime_{nullptr};
+  std::vector<CachedValue> cache_;
 };
 
 } // namespace facebook::react
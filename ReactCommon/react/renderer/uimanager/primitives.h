@@ -62,6 +62,18 @@ inline static ShadowNode::Shared shadowNodeFromValue(
       ->shadowNode;
 }
 
+/*
+ * Returns the node of `value` which must be a node (e.g. an element of an
+ * array of children). Unlike `shadowNodeFromValue`, throws if it is not.
+ */
+inline static ShadowNode::Shared childShadowNodeFromValue(
+    jsi::Runtime &runtime,
+    jsi::Value const &value) {
+  return value.asObject(runtime)
+      .asHostObject<ShadowNodeWrapper>(runtime)
+      ->shadowNode;
+}
+
 inline static jsi::Value valueFromShadowNode(
     jsi::Runtime &runtime,
     const ShadowNode::Shared &shadowNode) {
@@ -80,6 +92,7 @@ inline static SharedShadowNodeUnsharedList shadowNodeListFromValue(
 inline static ShadowNode::UnsharedListOfShared shadowNodeListFromWeakList(
     ShadowNode::UnsharedListOfWeak const &weakShadowNodeList) {
   auto result = std::make_shared<ShadowNode::ListOfShared>();
+  result->reserve(weakShadowNodeList->size());
   for (auto const &weakShadowNode : *weakShadowNodeList) {
     auto sharedShadowNode = weakShadowNode.lock();
     if (!sharedShadowNode) {
@@ -90,14 +103,31 @@ inline static ShadowNode::UnsharedListOfShared shadowNodeListFromWeakList(
   return result;
 }
 
+/*
+ * Accepts either a child set created by `createChildSet` or an array of nodes
+ * (which JavaScript fills in bulk without calling into native per child).
+ * Throws if `value` is neither or if an element of the array is not a node.
+ */
 inline static ShadowNode::UnsharedListOfWeak weakShadowNodeListFromValue(
     jsi::Runtime &runtime,
     jsi::Value const &value) {
-  auto shadowNodeList = value.getObject(runtime)
-                            .getHostObject<ShadowNodeListWrapper>(runtime)
-                            ->shadowNodeList;
-
+  auto object = value.asObject(runtime);
   auto weakShadowNodeList = std::make_shared<ShadowNode::ListOfWeak>();
+
+  if (object.isArray(runtime)) {
+    auto array = object.getArray(runtime);
+    auto size = array.size(runtime);
+    weakShadowNodeList->reserve(size);
+    for (size_t i = 0; i < size; i++) {
+      weakShadowNodeList->push_back(
+          childShadowNodeFromValue(runtime, array.getValueAtIndex(runtime, i)));
+    }
+    return weakShadowNodeList;
+  }
+
+  auto shadowNodeList =
+      object.asHostObject<ShadowNodeListWrapper>(runtime)->shadowNodeList;
+  weakShadowNodeList->reserve(shadowNodeList->size());
   for (auto const &shadowNode : *shadowNodeList) {
     weakShadowNodeList->push_back(shadowNode);
   }
@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <hermes/API/hermes/hermes.h>
+#include <jsi/decorator.h>
+#include <jsi/jsi.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/uimanager/UIManager.h>
+#include <react/renderer/uimanager/UIManagerBinding.h>
+
+using namespace facebook;
+using namespace facebook::react;
+
+/*
+ * Forwards everything to the plain runtime (like runtimes decorated for
+ * tracing or debugging do).
+ */
+class DecoratedRuntime : public jsi::RuntimeDecorator<jsi::Runtime> {
+ public:
+  explicit DecoratedRuntime(jsi::Runtime &plain) : RuntimeDecorator(plain) {}
+};
+
+class UIManagerBindingTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    runtime_ = facebook::hermes::makeHermesRuntime();
+    binding_ = std::make_shared<UIManagerBinding>(nullptr, RuntimeExecutor{});
+  }
+
+  jsi::Value get(jsi::Runtime &runtime, char const *name) {
+    return binding_->get(runtime, jsi::PropNameID::forAscii(runtime, name));
+  }
+
+  bool areSameObjects(jsi::Value const &lhs, jsi::Value const &rhs) {
+    return lhs.isObject() && rhs.isObject() &&
+        jsi::Value::strictEquals(*runtime_, lhs, rhs);
+  }
+
+  std::unique_ptr<facebook::hermes::HermesRuntime> runtime_;
+  std::shared_ptr<UIManagerBinding> binding_;
+};
+
+TEST_F(UIManagerBindingTest, getReturnsCachedValues) {
+  auto cloneNode = get(*runtime_, "cloneNode");
+  auto appendChild = get(*runtime_, "appendChild");
+
+  ASSERT_TRUE(cloneNode.isObject());
+  EXPECT_TRUE(cloneNode.getObject(*runtime_).isFunction(*runtime_));
+  EXPECT_FALSE(areSameObjects(cloneNode, appendChild));
+
+  // Equal names (but different `PropNameID` objects) get the same value.
+  EXPECT_TRUE(areSameObjects(get(*runtime_, "cloneNode"), cloneNode));
+  EXPECT_TRUE(areSameObjects(get(*runtime_, "appendChild"), appendChild));
+}
+
+TEST_F(UIManagerBindingTest, getDoesNotCacheUnknownNames) {
+  EXPECT_TRUE(get(*runtime_, "unknownMethod").isUndefined());
+  EXPECT_TRUE(get(*runtime_, "unknownMethod").isUndefined());
+}
+
+TEST_F(UIManagerBindingTest, getBypassesCacheForOtherRuntimes) {
+  auto decoratedRuntime = DecoratedRuntime(*runtime_);
+
+  auto cloneNode = get(*runtime_, "cloneNode");
+
+  // The cache belongs to the first runtime the binding was accessed with.
+  auto decoratedCloneNode = get(decoratedRuntime, "cloneNode");
+  ASSERT_TRUE(decoratedCloneNode.isObject());
+  EXPECT_FALSE(areSameObjects(decoratedCloneNode, cloneNode));
+  EXPECT_FALSE(
+      areSameObjects(get(decoratedRuntime, "cloneNode"), decoratedCloneNode));
+
+  EXPECT_TRUE(areSameObjects(get(*runtime_, "cloneNode"), cloneNode));
+}
+
+/*
+ * Runs the binding against a real `UIManager` with a started surface, so
+ * JavaScript can create, commit and measure nodes.
+ */
+class UIManagerBindingSurfaceTest : public testing::Test {
+ protected:
+  constexpr static SurfaceId kSurfaceId = 1;
+
+  void SetUp() override {
+    auto contextContainer = std::make_shared<ContextContainer const>();
+
+    providerRegistry_ = std::make_shared<ComponentDescriptorProviderRegistry>();
+    providerRegistry_->add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+
+    // Commits scheduled by `completeRoot` are performed right away.
+    uiManager_ = std::make_shared<UIManager>(
+        RuntimeExecutor{},
+        [](std::function<void()> &&callback) { callback(); },
+        contextContainer);
+    uiManager_->setComponentDescriptorRegistry(
+        providerRegistry_->createComponentDescriptorRegistry(
+            {EventDispatcher::Shared{}, contextContainer, nullptr}));
+
+    auto layoutConstraints = LayoutConstraints{};
+    layoutConstraints.maximumSize = Size{1000, 1000};
+    uiManager_->startSurface(
+        std::make_unique<ShadowTree>(
+            kSurfaceId,
+            layoutConstraints,
+            LayoutContext{},
+            *uiManager_,
+            *contextContainer),
+        "Test",
+        folly::dynamic::object(),
+        DisplayMode::Visible);
+
+    runtime_ = facebook::hermes::makeHermesRuntime();
+    runtime_->global().setProperty(
+        *runtime_,
+        "nativeFabricUIManager",
+        jsi::Object::createFromHostObject(
+            *runtime_,
+            std::make_shared<UIManagerBinding>(
+                uiManager_, RuntimeExecutor{})));
+  }
+
+  void TearDown() override {
+    runtime_.reset();
+    uiManager_->stopSurface(kSurfaceId)->commitEmptyTree();
+  }
+
+  jsi::Value evaluate(std::string const &script) {
+    return runtime_->evaluateJavaScript(
+        std::make_shared<jsi::StringBuffer>(script), "test.js");
+  }
+
+  /*
+   * Evaluates `script` and returns the result of `JSON.stringify` of its
+   * value.
+   */
+  std::string evaluateToJSON(std::string const &script) {
+    return evaluate("JSON.stringify((() => {" + script + "})())")
+        .getString(*runtime_)
+        .utf8(*runtime_);
+  }
+
+  std::shared_ptr<ComponentDescriptorProviderRegistry> providerRegistry_;
+  std::shared_ptr<UIManager> uiManager_;
+  std::unique_ptr<facebook::hermes::HermesRuntime> runtime_;
+};
+
+TEST_F(UIManagerBindingSurfaceTest, measureManyMeasuresAllNodes) {
+  auto measurements = evaluateToJSON(R"(
+    const ui = nativeFabricUIManager;
+    const a = ui.createNode(2, 'View', 1, {width: 100, height: 50}, {});
+    const b = ui.createNode(3, 'View', 1, {width: 30, height: 40}, {});
+    const notMounted = ui.createNode(4, 'View', 1, {width: 10}, {});
+    ui.completeRoot(1, [a, b]);
+
+    let result;
+    ui.measureMany([b, notMounted, a], measurements => {
+      result = measurements;
+    });
+    return result;
+  )");
+
+  EXPECT_EQ(
+      measurements,
+      "[[0,50,30,40,0,50],[0,0,0,0,0,0],[0,0,100,50,0,0]]");
+}
+
+TEST_F(UIManagerBindingSurfaceTest, measureManyMatchesMeasure) {
+  auto measurements = evaluateToJSON(R"(
+    const ui = nativeFabricUIManager;
+    const parent = ui.createNode(
+        2, 'View', 1, {padding: 5, width: 200, height: 200}, {});
+    const child = ui.createNode(
+        3, 'View', 1, {marginTop: 7, width: 20, height: 20}, {});
+    ui.appendChild(parent, child);
+    ui.completeRoot(1, [parent]);
+
+    const single = [];
+    ui.measure(parent, (...values) => single.push(values));
+    ui.measure(child, (...values) => single.push(values));
+    let many;
+    ui.measureMany([parent, child], measurements => {
+      many = measurements;
+    });
+    return [single, many];
+  )");
+
+  EXPECT_EQ(
+      measurements,
+      "[[[0,0,200,200,0,0],[5,12,20,20,5,12]],"
+      "[[0,0,200,200,0,0],[5,12,20,20,5,12]]]");
+}
+
+TEST_F(UIManagerBindingSurfaceTest, createNodesReturnsRoots) {
+  auto sizes = evaluateToJSON(R"(
+    const ui = nativeFabricUIManager;
+    const nodes = [
+      2, 'View', {width: 10}, {}, null,
+      3, 'View', {width: 20}, {}, [0],
+      4, 'View', {width: 30}, {}, [],
+    ];
+    return [
+      ui.createNodes(1, nodes).length,
+      ui.createNodes(1, nodes, [0, 1, 2]).length,
+    ];
+  )");
+
+  EXPECT_EQ(sizes, "[2,3]");
+}
+
+TEST_F(UIManagerBindingSurfaceTest, createNodesThrowsOnMalformedInput) {
+  auto results = evaluateToJSON(R"(
+    const ui = nativeFabricUIManager;
+    const node = (tag, children) => [tag, 'View', {}, {}, children];
+    const inputs = [
+      // The length is not a multiple of the stride.
+      [[2, 'View', {}, {}]],
+      // Child indices are not indices of preceding nodes.
+      [[...node(2, null), ...node(3, [-1])]],
+      [[...node(2, null), ...node(3, [NaN])]],
+      [[...node(2, null), ...node(3, [0.5])]],
+      [[...node(2, null), ...node(3, ['0'])]],
+      [[...node(2, [1]), ...node(3, null)]],
+      [[...node(2, [0])]],
+      // Tags are not integers.
+      [[...node('2', null)]],
+      [[...node(Infinity, null)]],
+      // The view name is not a string.
+      [[2, 5, {}, {}, null]],
+      // The instance handle is not an object.
+      [[2, 'View', {}, null, null]],
+      // Root indices are not indices of nodes.
+      [node(2, null), [1]],
+      [node(2, null), [-1]],
+      // `nodes` is not an array.
+      [{length: 5}],
+    ];
+    return inputs.map(([nodes, roots]) => {
+      try {
+        ui.createNodes(1, nodes, roots);
+        return 'created';
+      } catch (error) {
+        return 'threw';
+      }
+    });
+  )");
+
+  EXPECT_EQ(
+      results,
+      "[\"threw\",\"threw\",\"threw\",\"threw\",\"threw\",\"threw\",\"threw\","
+      "\"threw\",\"threw\",\"threw\",\"threw\",\"threw\",\"threw\",\"threw\"]");
+}
+
+TEST_F(UIManagerBindingSurfaceTest, childSetsMixSingleAndArrayAppends) {
+  auto offsets = evaluateToJSON(R"(
+    const ui = nativeFabricUIManager;
+    const nodes = [10, 20, 30, 40, 50].map((height, index) =>
+      ui.createNode(index + 2, 'View', 1, {height}, {}));
+
+    const childSet = ui.createChildSet(1);
+    ui.appendChildToSet(childSet, nodes[0]);
+    ui.appendChildrenToSet(childSet, [nodes[1], nodes[2]]);
+    ui.appendChildrenToSet(childSet, []);
+    ui.appendChildToSet(childSet, nodes[3]);
+    ui.appendChildrenToSet(childSet, [nodes[4]]);
+    ui.completeRoot(1, childSet);
+
+    const offsets = [];
+    for (const node of nodes) {
+      ui.measure(node, (x, y) => offsets.push(y));
+    }
+
+    // An array of nodes can be committed directly as well.
+    ui.completeRoot(1, [nodes[4], nodes[0]]);
+    ui.measure(nodes[4], (x, y) => offsets.push(y));
+    ui.measure(nodes[0], (x, y) => offsets.push(y));
+    return offsets;
+  )");
+
+  EXPECT_EQ(offsets, "[0,10,30,60,100,0,50]");
+}
+
+TEST_F(UIManagerBindingSurfaceTest, childSetsRejectInvalidElements) {
+  auto results = evaluateToJSON(R"(
+    const ui = nativeFabricUIManager;
+    const node = ui.createNode(2, 'View', 1, {}, {});
+    const childSet = ui.createChildSet(1);
+    const invalidElements = [null, undefined, 5, 'node', {}, childSet];
+
+    const throws = callback => {
+      try {
+        callback();
+        return false;
+      } catch (error) {
+        return true;
+      }
+    };
+
+    return [
+      ...invalidElements.map(element =>
+        throws(() => ui.appendChildrenToSet(childSet, [node, element]))),
+      ...invalidElements.map(element =>
+        throws(() => ui.completeRoot(1, [node, element]))),
+      throws(() => ui.appendChildrenToSet(childSet, node)),
+      throws(() => ui.completeRoot(1, node)),
+      throws(() => ui.completeRoot(1, 5)),
+    ];
+  )");
+
+  EXPECT_EQ(
+      results,
+      "[true,true,true,true,true,true,"
+      "true,true,true,true,true,true,"
+      "true,true,true]");
+}
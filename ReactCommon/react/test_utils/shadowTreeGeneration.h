@@ -146,7 +146,7 @@ static inline ShadowNode::Unshared messWithLayoutableOnlyFlag(
   }
 
   if (entropy.random<bool>(0.1)) {
-    viewProps.shadowColor =
+    viewProps.mutableColdProps().shadowColor =
         entropy.random<bool>() ? SharedColor() : blackColor();
   }
 
@@ -195,7 +195,7 @@ static inline ShadowNode::Unshared messWithNodeFlattenednessFlags(
     viewProps.collapsable = true;
     viewProps.backgroundColor = SharedColor();
     viewProps.foregroundColor = SharedColor();
-    viewProps.shadowColor = SharedColor();
+    viewProps.mutableColdProps().shadowColor = SharedColor();
     viewProps.accessible = false;
     viewProps.zIndex = {};
     viewProps.pointerEvents = PointerEventsMode::Auto;
@@ -205,7 +205,7 @@ static inline ShadowNode::Unshared messWithNodeFlattenednessFlags(
     viewProps.nativeId = "42";
     viewProps.backgroundColor = whiteColor();
     viewProps.foregroundColor = blackColor();
-    viewProps.shadowColor = blackColor();
+    viewProps.mutableColdProps().shadowColor = blackColor();
     viewProps.accessible = true;
     viewProps.zIndex = {entropy.random<int>()};
     viewProps.pointerEvents = PointerEventsMode::None;